@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmark/benchmarks/containers/hash_map.cc" "benchmark/CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_map.cc.o" "gcc" "benchmark/CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_map.cc.o.d"
+  "/root/repo/benchmark/benchmarks/containers/hash_set.cc" "benchmark/CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_set.cc.o" "gcc" "benchmark/CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_set.cc.o.d"
+  "/root/repo/benchmark/benchmarks/types/hash.cc" "benchmark/CMakeFiles/zinc_bench.dir/benchmarks/types/hash.cc.o" "gcc" "benchmark/CMakeFiles/zinc_bench.dir/benchmarks/types/hash.cc.o.d"
+  "/root/repo/benchmark/main.cc" "benchmark/CMakeFiles/zinc_bench.dir/main.cc.o" "gcc" "benchmark/CMakeFiles/zinc_bench.dir/main.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_map.cc.o"
+  "CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_map.cc.o.d"
+  "CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_set.cc.o"
+  "CMakeFiles/zinc_bench.dir/benchmarks/containers/hash_set.cc.o.d"
+  "CMakeFiles/zinc_bench.dir/benchmarks/types/hash.cc.o"
+  "CMakeFiles/zinc_bench.dir/benchmarks/types/hash.cc.o.d"
+  "CMakeFiles/zinc_bench.dir/main.cc.o"
+  "CMakeFiles/zinc_bench.dir/main.cc.o.d"
+  "zinc_bench"
+  "zinc_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zinc_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zinc_main.dir/main.cc.o"
+  "CMakeFiles/zinc_main.dir/main.cc.o.d"
+  "zinc_main"
+  "zinc_main.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zinc_main.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/main.cc" "tests/CMakeFiles/zinc_test.dir/main.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/main.cc.o.d"
+  "/root/repo/tests/tests/containers/concurrent_hash_map.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/concurrent_hash_map.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/concurrent_hash_map.cc.o.d"
+  "/root/repo/tests/tests/containers/concurrent_queue.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/concurrent_queue.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/concurrent_queue.cc.o.d"
+  "/root/repo/tests/tests/containers/devec.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/devec.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/devec.cc.o.d"
+  "/root/repo/tests/tests/containers/frozen_hash_map.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/frozen_hash_map.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/frozen_hash_map.cc.o.d"
+  "/root/repo/tests/tests/containers/graph.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/graph.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/graph.cc.o.d"
+  "/root/repo/tests/tests/containers/graph_algorithms.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/graph_algorithms.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/graph_algorithms.cc.o.d"
+  "/root/repo/tests/tests/containers/hash_map.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/hash_map.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/hash_map.cc.o.d"
+  "/root/repo/tests/tests/containers/hash_set.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/hash_set.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/hash_set.cc.o.d"
+  "/root/repo/tests/tests/containers/node_hash_map.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/node_hash_map.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/node_hash_map.cc.o.d"
+  "/root/repo/tests/tests/containers/ring_deque.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/ring_deque.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/ring_deque.cc.o.d"
+  "/root/repo/tests/tests/containers/small.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/small.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/small.cc.o.d"
+  "/root/repo/tests/tests/containers/string_interner.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/string_interner.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/string_interner.cc.o.d"
+  "/root/repo/tests/tests/containers/table_policy.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/table_policy.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/table_policy.cc.o.d"
+  "/root/repo/tests/tests/containers/vec.cc" "tests/CMakeFiles/zinc_test.dir/tests/containers/vec.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/containers/vec.cc.o.d"
+  "/root/repo/tests/tests/io/async_file.cc" "tests/CMakeFiles/zinc_test.dir/tests/io/async_file.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/io/async_file.cc.o.d"
+  "/root/repo/tests/tests/io/async_log.cc" "tests/CMakeFiles/zinc_test.dir/tests/io/async_log.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/io/async_log.cc.o.d"
+  "/root/repo/tests/tests/io/console.cc" "tests/CMakeFiles/zinc_test.dir/tests/io/console.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/io/console.cc.o.d"
+  "/root/repo/tests/tests/io/file.cc" "tests/CMakeFiles/zinc_test.dir/tests/io/file.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/io/file.cc.o.d"
+  "/root/repo/tests/tests/io/split.cc" "tests/CMakeFiles/zinc_test.dir/tests/io/split.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/io/split.cc.o.d"
+  "/root/repo/tests/tests/io/streaming_file.cc" "tests/CMakeFiles/zinc_test.dir/tests/io/streaming_file.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/io/streaming_file.cc.o.d"
+  "/root/repo/tests/tests/parallel/algorithms.cc" "tests/CMakeFiles/zinc_test.dir/tests/parallel/algorithms.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/parallel/algorithms.cc.o.d"
+  "/root/repo/tests/tests/parallel/thread_pool.cc" "tests/CMakeFiles/zinc_test.dir/tests/parallel/thread_pool.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/parallel/thread_pool.cc.o.d"
+  "/root/repo/tests/tests/sanity.cc" "tests/CMakeFiles/zinc_test.dir/tests/sanity.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/sanity.cc.o.d"
+  "/root/repo/tests/tests/types/allocators.cc" "tests/CMakeFiles/zinc_test.dir/tests/types/allocators.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/types/allocators.cc.o.d"
+  "/root/repo/tests/tests/types/hash.cc" "tests/CMakeFiles/zinc_test.dir/tests/types/hash.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/types/hash.cc.o.d"
+  "/root/repo/tests/tests/types/iterators.cc" "tests/CMakeFiles/zinc_test.dir/tests/types/iterators.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/types/iterators.cc.o.d"
+  "/root/repo/tests/tests/types/pointers.cc" "tests/CMakeFiles/zinc_test.dir/tests/types/pointers.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/types/pointers.cc.o.d"
+  "/root/repo/tests/tests/types/storage.cc" "tests/CMakeFiles/zinc_test.dir/tests/types/storage.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/types/storage.cc.o.d"
+  "/root/repo/tests/tests/util/instrument.cc" "tests/CMakeFiles/zinc_test.dir/tests/util/instrument.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/util/instrument.cc.o.d"
+  "/root/repo/tests/tests/util/options.cc" "tests/CMakeFiles/zinc_test.dir/tests/util/options.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/util/options.cc.o.d"
+  "/root/repo/tests/tests/util/uninitialized.cc" "tests/CMakeFiles/zinc_test.dir/tests/util/uninitialized.cc.o" "gcc" "tests/CMakeFiles/zinc_test.dir/tests/util/uninitialized.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
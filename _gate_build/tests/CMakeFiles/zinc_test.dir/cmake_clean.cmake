@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zinc_test.dir/main.cc.o"
+  "CMakeFiles/zinc_test.dir/main.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/concurrent_hash_map.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/concurrent_hash_map.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/concurrent_queue.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/concurrent_queue.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/devec.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/devec.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/frozen_hash_map.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/frozen_hash_map.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/graph.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/graph.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/graph_algorithms.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/graph_algorithms.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/hash_map.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/hash_map.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/hash_set.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/hash_set.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/node_hash_map.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/node_hash_map.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/ring_deque.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/ring_deque.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/small.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/small.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/string_interner.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/string_interner.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/table_policy.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/table_policy.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/containers/vec.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/containers/vec.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/io/async_file.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/io/async_file.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/io/async_log.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/io/async_log.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/io/console.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/io/console.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/io/file.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/io/file.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/io/split.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/io/split.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/io/streaming_file.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/io/streaming_file.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/parallel/algorithms.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/parallel/algorithms.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/parallel/thread_pool.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/parallel/thread_pool.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/sanity.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/sanity.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/types/allocators.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/types/allocators.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/types/hash.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/types/hash.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/types/iterators.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/types/iterators.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/types/pointers.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/types/pointers.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/types/storage.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/types/storage.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/util/instrument.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/util/instrument.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/util/options.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/util/options.cc.o.d"
+  "CMakeFiles/zinc_test.dir/tests/util/uninitialized.cc.o"
+  "CMakeFiles/zinc_test.dir/tests/util/uninitialized.cc.o.d"
+  "zinc_test"
+  "zinc_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zinc_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,148 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/hash_map.h"
+#include "../support.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    // every benchmark here is templated over the map so zinc and the
+    // standard library run the exact same workload, and so the next keyed
+    // container can reuse them by adding registration lines
+    template <typename Map> Map filled_with(const std::vector<typename Map::key_type>& keys)
+    {
+        auto map = Map();
+
+        for (const auto& key : keys)
+        {
+            map.emplace(key, std::uint64_t{1});
+        }
+
+        return map;
+    }
+
+    template <typename Map, auto MakeKeys> void map_insert(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            auto map = filled_with<Map>(keys.present);
+
+            benchmark::DoNotOptimize(map);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, auto MakeKeys> void map_find_hit(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+        const auto map = filled_with<Map>(keys.present);
+
+        for (auto _ : state)
+        {
+            auto found = std::size_t{0};
+
+            for (const auto& key : keys.present)
+            {
+                found += map.contains(key);
+            }
+
+            benchmark::DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, auto MakeKeys> void map_find_miss(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+        const auto map = filled_with<Map>(keys.present);
+
+        for (auto _ : state)
+        {
+            auto found = std::size_t{0};
+
+            for (const auto& key : keys.absent)
+            {
+                found += map.contains(key);
+            }
+
+            benchmark::DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, auto MakeKeys> void map_erase_half(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto map = filled_with<Map>(keys.present);
+            state.ResumeTiming();
+
+            for (auto i = std::size_t{0}; i < keys.present.size(); i += 2)
+            {
+                map.erase(keys.present[i]);
+            }
+
+            benchmark::DoNotOptimize(map);
+        }
+
+        state.SetItemsProcessed(state.iterations() * (state.range(0) / 2));
+    }
+
+    using ZincIntMap = zinc::HashMap<std::uint64_t, std::uint64_t>;
+    using StdIntMap = std::unordered_map<std::uint64_t, std::uint64_t>;
+    using ZincUrlMap = zinc::HashMap<std::string, std::uint64_t>;
+    using StdUrlMap = std::unordered_map<std::string, std::uint64_t>;
+
+    constexpr auto random_ints = bench::random_integer_keys;
+    constexpr auto dense_ints = bench::dense_integer_keys;
+
+    // 40-200 byte URLs are the production key shape, 64 is the middle of it
+    bench::KeySet<std::string> urls(std::size_t count) { return bench::url_keys(count, 64); }
+} // namespace
+
+BENCHMARK(map_insert<ZincIntMap, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_insert<StdIntMap, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_insert<ZincUrlMap, urls>)->Range(1 << 10, 1 << 16);
+BENCHMARK(map_insert<StdUrlMap, urls>)->Range(1 << 10, 1 << 16);
+
+BENCHMARK(map_find_hit<ZincIntMap, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_find_hit<StdIntMap, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_find_hit<ZincIntMap, dense_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_find_hit<StdIntMap, dense_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_find_hit<ZincUrlMap, urls>)->Range(1 << 10, 1 << 16);
+BENCHMARK(map_find_hit<StdUrlMap, urls>)->Range(1 << 10, 1 << 16);
+
+BENCHMARK(map_find_miss<ZincIntMap, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_find_miss<StdIntMap, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(map_find_miss<ZincUrlMap, urls>)->Range(1 << 10, 1 << 16);
+BENCHMARK(map_find_miss<StdUrlMap, urls>)->Range(1 << 10, 1 << 16);
+
+BENCHMARK(map_erase_half<ZincIntMap, random_ints>)->Range(1 << 10, 1 << 18);
+BENCHMARK(map_erase_half<StdIntMap, random_ints>)->Range(1 << 10, 1 << 18);
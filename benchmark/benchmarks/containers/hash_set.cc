@@ -0,0 +1,128 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/hash_set.h"
+#include "../support.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <unordered_set>
+
+namespace
+{
+    template <typename Set> Set set_filled_with(const std::vector<typename Set::key_type>& keys)
+    {
+        auto set = Set();
+
+        for (const auto& key : keys)
+        {
+            set.emplace(key);
+        }
+
+        return set;
+    }
+
+    template <typename Set, auto MakeKeys> void set_insert(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state)
+        {
+            auto set = set_filled_with<Set>(keys.present);
+
+            benchmark::DoNotOptimize(set);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Set, auto MakeKeys> void set_find_hit(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+        const auto set = set_filled_with<Set>(keys.present);
+
+        for (auto _ : state)
+        {
+            auto found = std::size_t{0};
+
+            for (const auto& key : keys.present)
+            {
+                found += set.contains(key);
+            }
+
+            benchmark::DoNotOptimize(found);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // iteration at varying occupancy: fill to `range(0)` keys, then erase all
+    // but one key in `range(1)`, so a sparse table has to skip the same
+    // capacity's worth of empty (and tombstoned) slots a dense one sums through
+    template <typename Set, auto MakeKeys> void set_iterate(benchmark::State& state)
+    {
+        const auto keys = MakeKeys(static_cast<std::size_t>(state.range(0)));
+        const auto keep_every = static_cast<std::size_t>(state.range(1));
+        auto set = set_filled_with<Set>(keys.present);
+
+        for (auto i = std::size_t{0}; i < keys.present.size(); ++i)
+        {
+            if (i % keep_every != 0)
+            {
+                set.erase(keys.present[i]);
+            }
+        }
+
+        for (auto _ : state)
+        {
+            auto sum = std::uint64_t{0};
+
+            for (const auto& key : set)
+            {
+                sum += key;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(set.size()));
+    }
+
+    using ZincIntSet = zinc::HashSet<std::uint64_t>;
+    using StdIntSet = std::unordered_set<std::uint64_t>;
+
+    constexpr auto random_ints = bench::random_integer_keys;
+    constexpr auto dense_ints = bench::dense_integer_keys;
+} // namespace
+
+BENCHMARK(set_insert<ZincIntSet, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(set_insert<StdIntSet, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(set_insert<ZincIntSet, dense_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(set_insert<StdIntSet, dense_ints>)->Range(1 << 10, 1 << 20);
+
+BENCHMARK(set_find_hit<ZincIntSet, random_ints>)->Range(1 << 10, 1 << 20);
+BENCHMARK(set_find_hit<StdIntSet, random_ints>)->Range(1 << 10, 1 << 20);
+
+// full, half, and five-percent occupancy over the same capacity
+BENCHMARK(set_iterate<ZincIntSet, random_ints>)
+    ->Args({1 << 16, 1})
+    ->Args({1 << 16, 2})
+    ->Args({1 << 16, 20});
+BENCHMARK(set_iterate<StdIntSet, random_ints>)
+    ->Args({1 << 16, 1})
+    ->Args({1 << 16, 2})
+    ->Args({1 << 16, 20});
@@ -0,0 +1,112 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_BENCHMARKS_SUPPORT
+#define ZINC_BENCHMARKS_SUPPORT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/// Shared key-set fixtures for the container benchmarks. Everything is
+/// seeded deterministically so runs are comparable across machines and
+/// commits, and the same generators work for any keyed container that
+/// lands later - the benchmarks only care about `present`/`absent`.
+namespace bench
+{
+    /// A set of keys to build a container from, plus an equally-shaped set
+    /// that was never inserted - hit and miss probes over the same
+    /// distribution
+    template <typename K> struct KeySet
+    {
+        std::vector<K> present;
+
+        std::vector<K> absent;
+    };
+
+    /// Uniformly random 64-bit keys, the friendly case for any hash
+    inline KeySet<std::uint64_t> random_integer_keys(std::size_t count)
+    {
+        auto engine = std::mt19937_64(0x5eed);
+        auto keys = KeySet<std::uint64_t>();
+
+        for (auto i = std::size_t{0}; i < count; ++i)
+        {
+            keys.present.push_back(engine());
+            keys.absent.push_back(engine());
+        }
+
+        return keys;
+    }
+
+    /// Sequential IDs (shuffled so insertion order isn't the probe order),
+    /// the adversarial case for identity-ish integer hashes
+    inline KeySet<std::uint64_t> dense_integer_keys(std::size_t count)
+    {
+        auto engine = std::mt19937_64(0x5eed);
+        auto keys = KeySet<std::uint64_t>();
+
+        for (auto i = std::size_t{0}; i < count; ++i)
+        {
+            keys.present.push_back(i);
+            keys.absent.push_back(i + count);
+        }
+
+        std::shuffle(keys.present.begin(), keys.present.end(), engine);
+        std::shuffle(keys.absent.begin(), keys.absent.end(), engine);
+
+        return keys;
+    }
+
+    /// URL-shaped string keys of a fixed length: a common prefix (as real
+    /// URL sets have) with a random path, so both the hash and the equality
+    /// comparison have to read past the shared bytes
+    inline KeySet<std::string> url_keys(std::size_t count, std::size_t length)
+    {
+        constexpr const char* prefix = "https://bench.example.com/";
+        constexpr const char* alphabet = "abcdefghijklmnopqrstuvwxyz0123456789/-_";
+
+        auto engine = std::mt19937_64(0x5eed);
+        auto pick = std::uniform_int_distribution<std::size_t>(0, 38);
+        auto keys = KeySet<std::string>();
+
+        const auto make_one = [&] {
+            auto url = std::string(prefix);
+
+            while (url.size() < length)
+            {
+                url.push_back(alphabet[pick(engine)]);
+            }
+
+            return url;
+        };
+
+        for (auto i = std::size_t{0}; i < count; ++i)
+        {
+            keys.present.push_back(make_one());
+            keys.absent.push_back(make_one());
+        }
+
+        return keys;
+    }
+} // namespace bench
+
+#endif
@@ -0,0 +1,76 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/types/functors/hash.h"
+#include "../support.h"
+#include "benchmark/benchmark.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // throughput by key length, one key per iteration so short-key overhead
+    // (the fixed mixing cost) is visible separately from bulk bandwidth
+    void hash_bytes_by_length(benchmark::State& state)
+    {
+        const auto length = static_cast<std::size_t>(state.range(0));
+        const auto keys = bench::url_keys(1, std::max(length, std::size_t{27}));
+        const auto& key = keys.present[0];
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(zinc::hash_bytes(key.data(), length));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(length));
+    }
+
+    // the libstdc++ byte-at-a-time hash, as the baseline zinc::Hash replaced
+    void std_hash_by_length(benchmark::State& state)
+    {
+        const auto length = static_cast<std::size_t>(state.range(0));
+        const auto keys = bench::url_keys(1, std::max(length, std::size_t{27}));
+        const auto view = std::string_view(keys.present[0]).substr(0, length);
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(std::hash<std::string_view>{}(view));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(length));
+    }
+
+    void integer_hash(benchmark::State& state)
+    {
+        auto id = std::uint64_t{0};
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(zinc::Hash<std::uint64_t>()(id++));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+} // namespace
+
+// 32..200 covers the production URL range, the big sizes measure bandwidth
+BENCHMARK(hash_bytes_by_length)->Arg(8)->Arg(32)->Arg(64)->Arg(200)->Arg(4096)->Arg(1 << 16);
+BENCHMARK(std_hash_by_length)->Arg(8)->Arg(32)->Arg(64)->Arg(200)->Arg(4096)->Arg(1 << 16);
+BENCHMARK(integer_hash);
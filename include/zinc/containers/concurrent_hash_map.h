@@ -0,0 +1,278 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_CONCURRENT_HASH_MAP
+#define ZINC_CONTAINERS_CONCURRENT_HASH_MAP
+
+#include "zinc/containers/hash_map.h"
+#include "zinc/types/functors.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+
+namespace zinc
+{
+    /// A hash map for shared mutation across many threads, built by sharding
+    /// keys over independent `HashMap`s with one `shared_mutex` each. Readers
+    /// on different shards never touch the same lock, and a write burst only
+    /// stalls readers of the one shard it lands in - the failure mode of a
+    /// whole map behind one `shared_mutex`, where every writer stalls all
+    /// readers, can't happen.
+    ///
+    /// The key is hashed exactly once: the same hash picks the shard (from its
+    /// high bits) and probes inside it (via `HashToken`, which is what the
+    /// flat tables already accept to skip re-hashing).
+    ///
+    /// The API is deliberately callback-shaped (`find_fn`, `modify_fn`,
+    /// `insert_or_update`) instead of iterator-shaped: an iterator into a
+    /// shard is a pointer other threads can invalidate, so references only
+    /// exist inside a callback, where the shard lock is known to be held.
+    template <typename Key,
+        typename Value,
+        HashFn<Key> Hash = zinc::Hash<Key>,
+        EqFn<Key> Eq = zinc::EqualTo<Key>,
+        Allocator<std::pair<const Key, Value>> Alloc = std::allocator<std::pair<const Key, Value>>>
+    class ConcurrentHashMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using size_type = std::size_t;
+
+        /// Creates a map with at least `shards` independent shards (rounded up
+        /// to a power of two). More shards means less lock contention and more
+        /// fixed overhead; the default suits a few dozen threads.
+        ///
+        /// # Parameters
+        /// - `shards`: The minimum number of shards to spread keys over
+        explicit ConcurrentHashMap(size_type shards = default_shard_count)
+            : shard_bits_(static_cast<size_type>(std::bit_width(std::bit_ceil(std::max(shards, size_type{1})) - 1)))
+            , shards_(std::make_unique<Shard[]>(size_type{1} << shard_bits_))
+        {}
+
+        /// Looks up a key and hands the mapped value to `callback` under the
+        /// shard's reader lock. The reference is only valid inside the
+        /// callback - don't let it escape.
+        ///
+        /// # Parameters
+        /// - `key`: The key to look for
+        /// - `callback`: Called as `callback(const Value&)` if the key is present
+        ///
+        /// # Returns
+        /// Whether the key was found (and the callback run)
+        template <typename Fn> bool find_fn(const key_type& key, Fn&& callback) const
+        {
+            const auto token = token_for(key);
+            const auto& shard = shard_for(token);
+            auto lock = std::shared_lock(shard.mutex);
+
+            if (auto it = shard.map.find(token, key); it != shard.map.end())
+            {
+                std::forward<Fn>(callback)(it->second);
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /// Looks up a key and hands the mapped value to `callback` mutably,
+        /// under the shard's writer lock
+        ///
+        /// # Parameters
+        /// - `key`: The key to look for
+        /// - `callback`: Called as `callback(Value&)` if the key is present
+        ///
+        /// # Returns
+        /// Whether the key was found (and the callback run)
+        template <typename Fn> bool modify_fn(const key_type& key, Fn&& callback)
+        {
+            const auto token = token_for(key);
+            auto& shard = shard_for(token);
+            auto lock = std::unique_lock(shard.mutex);
+
+            if (auto it = shard.map.find(token, key); it != shard.map.end())
+            {
+                std::forward<Fn>(callback)(it->second);
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /// Maps `key` to a value built from `args`, overwriting whatever value
+        /// it previously mapped to (if any)
+        ///
+        /// # Parameters
+        /// - `key`: The key to insert or update
+        /// - `args`: The arguments the mapped value is constructed from
+        ///
+        /// # Returns
+        /// `true` if the key was inserted, `false` if it was updated
+        template <typename... Args> bool insert_or_update(const key_type& key, Args&&... args)
+        {
+            const auto token = token_for(key);
+            auto& shard = shard_for(token);
+            auto lock = std::unique_lock(shard.mutex);
+
+            if (auto it = shard.map.find(token, key); it != shard.map.end())
+            {
+                it->second = mapped_type(std::forward<Args>(args)...);
+
+                return false;
+            }
+
+            shard.map.emplace_with_hash(token, key, mapped_type(std::forward<Args>(args)...));
+
+            return true;
+        }
+
+        /// Inserts a mapping only if the key isn't present, leaving an
+        /// existing value untouched (the `try_emplace` of this API)
+        ///
+        /// # Parameters
+        /// - `key`: The key to insert
+        /// - `args`: The arguments the mapped value is constructed from
+        ///
+        /// # Returns
+        /// Whether the mapping was inserted
+        template <typename... Args> bool try_insert(const key_type& key, Args&&... args)
+        {
+            const auto token = token_for(key);
+            auto& shard = shard_for(token);
+            auto lock = std::unique_lock(shard.mutex);
+
+            if (shard.map.find(token, key) != shard.map.end())
+            {
+                return false;
+            }
+
+            shard.map.emplace_with_hash(token, key, mapped_type(std::forward<Args>(args)...));
+
+            return true;
+        }
+
+        /// Removes a key's mapping, if it has one
+        ///
+        /// # Parameters
+        /// - `key`: The key to remove
+        ///
+        /// # Returns
+        /// Whether a mapping was removed
+        bool erase(const key_type& key)
+        {
+            const auto token = token_for(key);
+            auto& shard = shard_for(token);
+            auto lock = std::unique_lock(shard.mutex);
+
+            if (auto it = shard.map.find(token, key); it != shard.map.end())
+            {
+                shard.map.erase(it);
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /// Checks if a key has a mapping
+        ///
+        /// # Parameters
+        /// - `key`: The key to look for
+        [[nodiscard]] bool contains(const key_type& key) const
+        {
+            const auto token = token_for(key);
+            const auto& shard = shard_for(token);
+            auto lock = std::shared_lock(shard.mutex);
+
+            return shard.map.find(token, key) != shard.map.end();
+        }
+
+        /// Counts the mappings across every shard. Each shard is locked in
+        /// turn, so under concurrent writes the result is a snapshot of no
+        /// particular instant.
+        [[nodiscard]] size_type size() const
+        {
+            auto total = size_type{0};
+
+            for (auto i = size_type{0}; i < shard_count(); ++i)
+            {
+                auto lock = std::shared_lock(shards_[i].mutex);
+
+                total += shards_[i].map.size();
+            }
+
+            return total;
+        }
+
+        /// Checks whether no shard has any mappings, with `size()`'s caveat
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+        /// Removes every mapping, one shard at a time
+        void clear()
+        {
+            for (auto i = size_type{0}; i < shard_count(); ++i)
+            {
+                auto lock = std::unique_lock(shards_[i].mutex);
+
+                shards_[i].map.clear();
+            }
+        }
+
+        /// Gets the number of independent shards keys are spread over
+        [[nodiscard]] size_type shard_count() const noexcept { return size_type{1} << shard_bits_; }
+
+    private:
+        constexpr static size_type default_shard_count = 16;
+
+        // padded so one shard's lock traffic doesn't evict its neighbor's
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            HashMap<Key, Value, Hash, Eq, Alloc> map;
+        };
+
+        [[nodiscard]] HashToken token_for(const key_type& key) const
+        {
+            // any shard's hasher works, they're all the same stateless functor
+            return HashToken(shards_[0].map.hash_function()(key));
+        }
+
+        [[nodiscard]] size_type shard_index(HashToken token) const noexcept
+        {
+            // the tables probe from the (mixed) low bits, so the shard comes
+            // from the high ones - a shard's keys shouldn't cluster inside it
+            return shard_bits_ == 0 ? 0 : token.raw() >> (std::numeric_limits<size_type>::digits - shard_bits_);
+        }
+
+        [[nodiscard]] Shard& shard_for(HashToken token) noexcept { return shards_[shard_index(token)]; }
+
+        [[nodiscard]] const Shard& shard_for(HashToken token) const noexcept { return shards_[shard_index(token)]; }
+
+        size_type shard_bits_;
+        std::unique_ptr<Shard[]> shards_;
+    };
+} // namespace zinc
+
+#endif
@@ -0,0 +1,278 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_CONCURRENT_QUEUE
+#define ZINC_CONTAINERS_CONCURRENT_QUEUE
+
+#include "zinc/types/aliases.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace zinc
+{
+    /// The threaded sibling of `RingDeque`: a bounded MPMC queue over the same
+    /// power-of-two ring layout, for pipeline stages that currently hand work
+    /// across threads through a mutex-guarded deque. Any number of producers
+    /// and consumers may call into it concurrently (which covers the SPSC case
+    /// as the degenerate one), and no operation ever takes a lock - the
+    /// scaling ceiling is the cache-line bounce on the cursors, not a critical
+    /// section.
+    ///
+    /// Each slot carries a sequence number (the Vyukov bounded-queue design)
+    /// that tells producers when it's free and consumers when it's full, so a
+    /// push is one CAS on the cache-line-padded tail cursor plus a move into
+    /// the slot, and a pop mirrors it on the head cursor.
+    ///
+    /// Bounded means bounded: when the queue is full, `try_push` says no
+    /// instead of allocating, blocking, or silently dropping. Capacity is
+    /// fixed at construction because growing a ring under concurrent access
+    /// is a lock in disguise.
+    template <typename T> class ConcurrentQueue
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        /// Creates a queue holding at least `capacity` items (rounded up to a
+        /// power of two)
+        ///
+        /// # Parameters
+        /// - `capacity`: The minimum number of items the queue can hold at once
+        explicit ConcurrentQueue(size_type capacity)
+            : mask_(std::bit_ceil(std::max(capacity, size_type{2})) - 1)
+            , cells_(std::make_unique<Cell[]>(mask_ + 1))
+        {
+            for (auto i = size_type{0}; i <= mask_; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        ConcurrentQueue(const ConcurrentQueue&) = delete;
+
+        ConcurrentQueue(ConcurrentQueue&&) = delete;
+
+        ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+        ConcurrentQueue& operator=(ConcurrentQueue&&) = delete;
+
+        /// Destroys whatever items are still queued. Like any concurrent
+        /// structure, all producers and consumers must be done first.
+        ~ConcurrentQueue()
+        {
+            while (try_pop().has_value())
+            {
+            }
+        }
+
+        /// Tries to construct an item at the back of the queue, refusing if
+        /// the queue is full. One CAS on the tail cursor plus the construction
+        /// itself.
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the `T` from
+        ///
+        /// # Returns
+        /// Whether there was room for the item
+        template <typename... Args> [[nodiscard]] bool try_emplace(Args&&... args)
+        {
+            auto pos = tail_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+
+                const auto seq = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // the consumer side hasn't freed this slot: full
+                    return false;
+                }
+                else
+                {
+                    // another producer claimed it first
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+
+            std::construct_at(value_ptr(*cell), std::forward<Args>(args)...);
+
+            // publishes the item to whichever consumer reaches this slot
+            cell->sequence.store(pos + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /// Tries to push a copy of an item, refusing if the queue is full
+        ///
+        /// # Parameters
+        /// - `value`: The value to copy in
+        ///
+        /// # Returns
+        /// Whether there was room for the item
+        [[nodiscard]] bool try_push(const T& value) { return try_emplace(value); }
+
+        /// Tries to move an item in, refusing if the queue is full. The item
+        /// is only moved-from when `true` comes back.
+        ///
+        /// # Parameters
+        /// - `value`: The value to move in
+        ///
+        /// # Returns
+        /// Whether there was room for the item
+        [[nodiscard]] bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+        /// Tries to pop the item at the front of the queue. One CAS on the
+        /// head cursor plus the move out.
+        ///
+        /// # Returns
+        /// The popped item, or `std::nullopt` if the queue was empty
+        [[nodiscard]] std::optional<T> try_pop()
+        {
+            auto pos = head_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+
+                const auto seq = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // no producer has filled this slot: empty
+                    return std::nullopt;
+                }
+                else
+                {
+                    // another consumer got here first
+                    pos = head_.load(std::memory_order_relaxed);
+                }
+            }
+
+            auto value = std::optional<T>(std::move(*value_ptr(*cell)));
+
+            std::destroy_at(value_ptr(*cell));
+
+            // hands the slot back to producers, one full lap ahead
+            cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+            return value;
+        }
+
+        /// Pushes as many of the given items as fit, in order, stopping at the
+        /// first that doesn't. The batch equivalent of `RingDeque`'s
+        /// `push_back_all`, for feeding a pipeline stage a chunk at a time.
+        ///
+        /// # Parameters
+        /// - `values`: The values to copy in, front to back
+        ///
+        /// # Returns
+        /// How many items made it in; the rest were never touched
+        [[nodiscard]] size_type push_n(std::span<const T> values)
+        {
+            auto pushed = size_type{0};
+
+            for (const auto& value : values)
+            {
+                if (!try_push(value))
+                {
+                    break;
+                }
+
+                ++pushed;
+            }
+
+            return pushed;
+        }
+
+        /// Pops up to `out.size()` items into `out`, front of the queue first
+        ///
+        /// # Parameters
+        /// - `out`: Where the popped items go, from the front
+        ///
+        /// # Returns
+        /// How many items came out; the rest of `out` is untouched
+        [[nodiscard]] size_type pop_n(std::span<T> out)
+        {
+            auto popped = size_type{0};
+
+            for (auto& slot : out)
+            {
+                auto value = try_pop();
+
+                if (!value.has_value())
+                {
+                    break;
+                }
+
+                slot = std::move(*value);
+                ++popped;
+            }
+
+            return popped;
+        }
+
+        /// Gets the number of items the queue can hold at once
+        [[nodiscard]] size_type capacity() const noexcept { return mask_ + 1; }
+
+    private:
+        // sequence and storage share a slot, padded so neighboring slots (and
+        // the claims on them) never false-share
+        struct alignas(64) Cell
+        {
+            std::atomic<std::size_t> sequence;
+            AlignedStorageFor<T> storage;
+        };
+
+        [[nodiscard]] static T* value_ptr(Cell& cell) noexcept { return reinterpret_cast<T*>(&cell.storage); }
+
+        size_type mask_;
+        std::unique_ptr<Cell[]> cells_;
+        // the cursors each get their own cache line: producers bounce tail_,
+        // consumers bounce head_, and neither interferes with the other
+        alignas(64) std::atomic<size_type> tail_ = 0;
+        alignas(64) std::atomic<size_type> head_ = 0;
+    };
+} // namespace zinc
+
+#endif
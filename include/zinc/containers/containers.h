@@ -20,10 +20,17 @@
 #define ZINC_CONTAINERS
 
 #include "zinc/containers/detail/small_adapter.h"
+#include "zinc/containers/concurrent_hash_map.h"
+#include "zinc/containers/concurrent_queue.h"
 #include "zinc/containers/devec.h"
+#include "zinc/containers/frozen_hash_map.h"
 #include "zinc/containers/graph.h"
+#include "zinc/containers/graph_algorithms.h"
 #include "zinc/containers/hash_map.h"
 #include "zinc/containers/hash_set.h"
+#include "zinc/containers/node_hash_map.h"
 #include "zinc/containers/ring_deque.h"
+#include "zinc/containers/string_interner.h"
+#include "zinc/containers/vec.h"
 
 #endif
\ No newline at end of file
@@ -29,7 +29,8 @@ namespace zinc::detail
         HashFn<K> Hash,
         EqFn<K> Eq,
         Allocator<K> Alloc,
-        SlotTraitsFor<std::pair<K, V>, std::pair<const K, V>> SlotTraits = MapSlotTraits<K, V>>
+        SlotTraitsFor<K, V> SlotTraits = MapSlotTraits<K, V>,
+        typename Policy = DefaultTablePolicy>
     struct DefaultMapTraits : SlotTraits
     {
         using SlotTraits::construct;
@@ -62,9 +63,11 @@ namespace zinc::detail
 
         using Allocator = Alloc;
 
-        [[nodiscard]] constexpr static std::size_t initial_size() noexcept { return 32; }
+        [[nodiscard]] constexpr static std::size_t initial_size() noexcept { return Policy::min_capacity; }
 
-        [[nodiscard]] constexpr static float max_load_factor() noexcept { return 0.72f; }
+        [[nodiscard]] constexpr static float max_load_factor() noexcept { return Policy::max_load_factor; }
+
+        [[nodiscard]] constexpr static std::size_t growth_factor() noexcept { return Policy::growth_factor; }
 
         [[nodiscard]] constexpr static const Key& key_from(const SlotValue& slot_value) { return slot_value.first; }
 
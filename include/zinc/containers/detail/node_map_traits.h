@@ -0,0 +1,152 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_DETAIL_NODE_MAP_TRAITS
+#define ZINC_CONTAINERS_DETAIL_NODE_MAP_TRAITS
+
+#include "zinc/containers/detail/map_traits.h"
+#include "zinc/containers/detail/slot_traits.h"
+#include "zinc/types/allocators.h"
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace zinc::detail
+{
+    // slot operations for node-based maps. The slot the table shuffles around
+    // is just a pointer: the pair itself lives in its own allocation and never
+    // moves, which is the entire point - rehashing shuffles pointers, and
+    // references into the map survive it
+    template <typename K, typename V> struct NodeMapSlotTraits
+    {
+        using Node = std::pair<std::remove_const_t<K>, V>;
+
+        using SlotValue = Node*;
+
+        using ImmutableSlotValue = std::pair<const std::remove_const_t<K>, V>*;
+
+        using SlotTraitsHandledTypes = std::tuple<K, V>;
+
+        // allocates a node through the (rebound) allocator and constructs the
+        // pair inside it, then points the slot at it
+        static void construct(Allocator<SlotValue> auto& alloc, SlotValue* slot, auto&&... args)
+        {
+            auto node_alloc = AllocRebind<std::remove_cvref_t<decltype(alloc)>, Node>(alloc);
+            auto* node = AllocTraits<decltype(node_alloc)>::allocate(node_alloc, 1);
+
+            try
+            {
+                AllocTraits<decltype(node_alloc)>::construct(node_alloc, node, std::forward<decltype(args)>(args)...);
+            }
+            catch (...)
+            {
+                AllocTraits<decltype(node_alloc)>::deallocate(node_alloc, node, 1);
+
+                throw;
+            }
+
+            std::construct_at(slot, node);
+        }
+
+        // tears down the pair and gives its node back to the allocator
+        static void destroy(Allocator<SlotValue> auto& alloc, SlotValue* slot)
+        {
+            auto node_alloc = AllocRebind<std::remove_cvref_t<decltype(alloc)>, Node>(alloc);
+
+            AllocTraits<decltype(node_alloc)>::destroy(node_alloc, *slot);
+            AllocTraits<decltype(node_alloc)>::deallocate(node_alloc, *slot, 1);
+        }
+
+        // a genuine deep copy: fresh node, copied pair
+        static void copy_to(Allocator<SlotValue> auto& alloc, const SlotValue* source, SlotValue* dest)
+        {
+            construct(alloc, dest, **source);
+        }
+
+        // the node never moves - handing over the pointer *is* the move
+        static void move_to(Allocator<SlotValue> auto&, SlotValue* source, SlotValue* dest) noexcept
+        {
+            std::construct_at(dest, *source);
+        }
+
+        // ditto: the source slot is dead afterwards, but the node lives on
+        // untouched under the new slot. A dead pointer needs no destructor
+        static void transfer_to(Allocator<SlotValue> auto&, SlotValue* source, SlotValue* dest) noexcept
+        {
+            std::construct_at(dest, *source);
+        }
+    };
+
+    /// `DefaultMapTraits` for node-based maps: identical policy knobs, but
+    /// `key_from`/`value_from` reach through the slot's pointer
+    template <typename K,
+        typename V,
+        HashFn<K> Hash,
+        EqFn<K> Eq,
+        Allocator<K> Alloc,
+        SlotTraitsFor<K, V> SlotTraits = NodeMapSlotTraits<K, V>,
+        typename Policy = DefaultTablePolicy>
+    struct NodeMapTraits : SlotTraits
+    {
+        using SlotTraits::construct;
+
+        using SlotTraits::destroy;
+
+        using SlotTraits::copy_to;
+
+        using SlotTraits::move_to;
+
+        using SlotTraits::transfer_to;
+
+        using typename SlotTraits::SlotValue;
+
+        using typename SlotTraits::ImmutableSlotValue;
+
+        using typename SlotTraits::SlotTraitsHandledTypes;
+
+        using Key = K;
+
+        using Mapped = V;
+
+        using MovableValue = std::pair<K, V>;
+
+        using Value = std::pair<const K, V>;
+
+        using Hasher = Hash;
+
+        using KeyEq = Eq;
+
+        using Allocator = Alloc;
+
+        [[nodiscard]] constexpr static std::size_t initial_size() noexcept { return Policy::min_capacity; }
+
+        [[nodiscard]] constexpr static float max_load_factor() noexcept { return Policy::max_load_factor; }
+
+        [[nodiscard]] constexpr static std::size_t growth_factor() noexcept { return Policy::growth_factor; }
+
+        [[nodiscard]] constexpr static const Key& key_from(const SlotValue& slot_value) { return slot_value->first; }
+
+        [[nodiscard]] constexpr static const Value& value_from(const ImmutableSlotValue& slot_value)
+        {
+            return *slot_value;
+        }
+    };
+} // namespace zinc::detail
+
+#endif
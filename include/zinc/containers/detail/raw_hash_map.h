@@ -24,6 +24,7 @@
 #include "zinc/types/functors.h"
 #include <functional>
 #include <memory>
+#include <tuple>
 #include <utility>
 
 namespace zinc::detail
@@ -69,10 +70,16 @@ namespace zinc::detail
 
         using Base::clear;
 
+        using Base::clear_and_release;
+
+        using Base::shrink_to_fit;
+
         using Base::insert;
 
         using Base::emplace;
 
+        using Base::emplace_with_hash;
+
         using Base::emplace_hint;
 
         using Base::erase;
@@ -85,6 +92,8 @@ namespace zinc::detail
 
         using Base::find;
 
+        using Base::find_many;
+
         using Base::contains;
 
         using Base::bucket_count;
@@ -101,62 +110,78 @@ namespace zinc::detail
 
         using Base::key_eq;
 
-        std::pair<iterator, bool> try_emplace(const key_type& key, auto&&... args) requires std::
-            constructible_from<value_type, std::piecewise_construct_t, const key_type&, decltype(args)...>
+        using Base::raw_storage;
+
+        using Base::small_buffer_slots;
+
+#ifdef ZINC_TABLE_STATS
+        using Base::stats;
+#endif
+
+        std::pair<iterator, bool> try_emplace(const key_type& key, auto&&... args) //
+            requires std::constructible_from<mapped_type, decltype(args)...>
         {
-            const auto hash_value = hash_key(key);
-            const auto [index, state] = probe_for<true>(key, hash_value);
+            Base::rehash_if_required();
+
+            const auto hash_value = Base::hash_key(key);
+            const auto [index, state] = Base::template probe_for<true>(key, hash_value);
 
             // tombstones can get re-used here, no point to leaving them as tombstones
             // when they'll just add to load_factor & get probed over anyway
             if (state != BucketState::full)
             {
+                if (state == BucketState::tombstone)
+                {
+                    --Base::tombstone_count_;
+                }
+
                 Traits::construct(Base::alloc_ref(),
                     Base::value_ptr_to(index),
                     std::piecewise_construct,
-                    key,
-                    std::forward<decltype(args)>(args)...);
+                    std::forward_as_tuple(key),
+                    std::forward_as_tuple(std::forward<decltype(args)>(args)...));
 
-                update_meta(index, BucketState::full);
+                Base::update_meta(index, hash_fragment(hash_value));
+                ++Base::size_;
+                Base::note_inserted_at(index);
 
-                if (state == BucketState::empty)
-                {
-                    ++Base::size_;
-                }
-
-                return {iterator_to(index), true};
+                return {Base::iterator_to(index), true};
             }
 
-            return {iterator_to(index), false};
+            return {Base::iterator_to(index), false};
         }
 
-        std::pair<iterator, bool> try_emplace(key_type&& key, auto&&... args) requires std::
-            constructible_from<value_type, std::piecewise_construct_t, key_type&&, decltype(args)...>
+        std::pair<iterator, bool> try_emplace(key_type&& key, auto&&... args) //
+            requires std::constructible_from<mapped_type, decltype(args)...>
         {
-            const auto hash_value = hash_key(key);
-            const auto [index, state] = probe_for<true>(key, hash_value);
+            Base::rehash_if_required();
+
+            const auto hash_value = Base::hash_key(key);
+            const auto [index, state] = Base::template probe_for<true>(key, hash_value);
 
             // tombstones can get re-used here, no point to leaving them as tombstones
             // when they'll just add to load_factor & get probed over anyway
             if (state != BucketState::full)
             {
+                if (state == BucketState::tombstone)
+                {
+                    --Base::tombstone_count_;
+                }
+
                 Traits::construct(Base::alloc_ref(),
                     Base::value_ptr_to(index),
                     std::piecewise_construct,
-                    std::move(key),
-                    std::forward<decltype(args)>(args)...);
-
-                update_meta(index, BucketState::full);
+                    std::forward_as_tuple(std::move(key)),
+                    std::forward_as_tuple(std::forward<decltype(args)>(args)...));
 
-                if (state == BucketState::empty)
-                {
-                    ++Base::size_;
-                }
+                Base::update_meta(index, hash_fragment(hash_value));
+                ++Base::size_;
+                Base::note_inserted_at(index);
 
-                return {iterator_to(index), true};
+                return {Base::iterator_to(index), true};
             }
 
-            return {iterator_to(index), false};
+            return {Base::iterator_to(index), false};
         }
 
         iterator try_emplace(const_iterator, const key_type& key, auto&&... args)
@@ -178,7 +203,7 @@ namespace zinc::detail
                 throw std::out_of_range("RawHashMap: key was not found");
             }
 
-            return *it;
+            return it->second;
         }
 
         [[nodiscard]] const mapped_type& at(const EqComparable<const key_type&, key_equal> auto& key) const
@@ -190,7 +215,7 @@ namespace zinc::detail
                 throw std::out_of_range("RawHashMap: key was not found");
             }
 
-            return *it;
+            return it->second;
         }
 
         mapped_type& operator[](const EqComparable<const key_type&, key_equal> auto& key)
@@ -20,6 +20,7 @@
 #define ZINC_CONTAINERS_DETAIL_RAW_HASH_SET
 
 #include "zinc/containers/detail/set_traits.h"
+#include "zinc/containers/detail/small_adapter.h"
 #include "zinc/io/console.h"
 #include "zinc/types/aliases.h"
 #include "zinc/types/allocators.h"
@@ -27,25 +28,356 @@
 #include "zinc/types/iterators.h"
 #include "zinc/types/pointers.h"
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <bit>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <initializer_list>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <ranges>
 #include <span>
 #include <utility>
 
+#if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#define ZINC_HASH_GROUP_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define ZINC_HASH_GROUP_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace zinc
+{
+    /// An opaque token carrying a key's hash, precomputed exactly once via the
+    /// table's `hash_function()`. Lets callers that probe the same key in
+    /// several tables (membership check in a `HashSet`, then a data fetch from
+    /// a `HashMap` sharing the hasher) pay for hashing only once.
+    class HashToken
+    {
+    public:
+        /// Wraps the raw result of `table.hash_function()(key)`
+        constexpr explicit HashToken(std::size_t hash) noexcept
+            : hash_(hash)
+        {}
+
+        /// Gets the raw hash value the token was created from
+        [[nodiscard]] constexpr std::size_t raw() const noexcept { return hash_; }
+
+    private:
+        std::size_t hash_;
+    };
+
+#ifdef ZINC_TABLE_STATS
+    /// Table-wide probe and rehash counters, accumulated when the library is
+    /// built with `ZINC_TABLE_STATS` and read back through `stats()` on the
+    /// hash tables. Useful for telling apart a bad hash distribution (high
+    /// mean probe length), tombstone buildup, and plain over-loading.
+    struct TableStats
+    {
+        /// Total metadata groups touched across all probed operations
+        std::size_t probes = 0;
+
+        /// Number of operations (finds/emplaces/erases) that probed the table
+        std::size_t operations = 0;
+
+        /// Longest single probe sequence seen, in groups
+        std::size_t max_probe_length = 0;
+
+        /// Times the table was rebuilt: growth, tombstone reclamation or shrinking
+        std::size_t rehashes = 0;
+
+        /// Tombstone count at the moment `stats()` was called
+        std::size_t tombstones = 0;
+
+        /// Mean number of groups probed per operation
+        [[nodiscard]] double mean_probe_length() const noexcept
+        {
+            return operations == 0 ? 0.0 : static_cast<double>(probes) / static_cast<double>(operations);
+        }
+    };
+#endif
+} // namespace zinc
+
 namespace zinc::detail
 {
     namespace ranges = std::ranges;
 
+    /// One metadata byte per slot. Slots that actually hold a value store the
+    /// top 7 bits of the key's hash (the "fragment") directly in the byte, so
+    /// probing can reject nearly every non-matching slot without ever touching
+    /// the value array. All non-full states keep the high bit set, which no
+    /// fragment ever does.
     enum class BucketState : unsigned char
     {
-        empty,
-        full,
-        tombstone,
+        empty = 0b1000'0000,
+        tombstone = 0b1111'1110,
+        // sentinel only ever used in return values, never stored in the meta
+        // table: full slots store their hash fragment instead
+        full = 0b1111'1111,
+    };
+
+    /// Checks if a metadata byte denotes a slot holding a value, i.e whether
+    /// it's a hash fragment rather than one of the `BucketState` constants
+    [[nodiscard]] constexpr bool is_full_state(BucketState state) noexcept
+    {
+        return (static_cast<unsigned char>(state) & 0b1000'0000) == 0;
+    }
+
+    /// Packs the top 7 bits of a hash into a metadata byte for a full slot
+    [[nodiscard]] constexpr BucketState hash_fragment(std::size_t hash) noexcept
+    {
+        return static_cast<BucketState>(hash >> (std::numeric_limits<std::size_t>::digits - 7));
+    }
+
+    /// Fibonacci multiplication, spreads low-entropy hashes (std::hash on
+    /// integers is the identity on the implementations we care about) across
+    /// the whole word so that masking off the low bits doesn't cluster, and
+    /// so the fragment bits at the top actually discriminate. Every consumer
+    /// of a table's layout (the table itself, frozen snapshot views) has to
+    /// mix with exactly this function or home slots won't line up.
+    [[nodiscard]] constexpr std::size_t mix_table_hash(std::size_t hash) noexcept
+    {
+        constexpr auto multiplier = sizeof(std::size_t) >= 8 ? static_cast<std::size_t>(0x9E3779B97F4A7C15ULL)
+                                                             : static_cast<std::size_t>(0x9E3779B9UL);
+
+        return hash * multiplier;
+    }
+
+    /// Best-effort hint to pull `address` into the data cache ahead of an
+    /// actual access. Compiles to nothing on toolchains without a prefetch
+    /// intrinsic.
+    inline void prefetch_read(const void* address) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#elif defined(ZINC_HASH_GROUP_SSE2)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+#ifdef ZINC_TABLE_STATS
+    // the live counters behind `stats()`. Relaxed atomics, because const
+    // probes update them too and the concurrent wrappers run those under
+    // shared locks - instrumentation must not introduce the only data race
+    // in the table.
+    struct TableStatsCounters
+    {
+        std::atomic<std::size_t> probes = 0;
+        std::atomic<std::size_t> operations = 0;
+        std::atomic<std::size_t> max_probe_length = 0;
+        std::atomic<std::size_t> rehashes = 0;
+
+        // container swap is single-threaded like every other mutation
+        void swap_with(TableStatsCounters& other) noexcept
+        {
+            const auto exchange = [](std::atomic<std::size_t>& a, std::atomic<std::size_t>& b) {
+                const auto held = a.load(std::memory_order_relaxed);
+
+                a.store(b.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                b.store(held, std::memory_order_relaxed);
+            };
+
+            exchange(probes, other.probes);
+            exchange(operations, other.operations);
+            exchange(max_probe_length, other.max_probe_length);
+            exchange(rehashes, other.rehashes);
+        }
+    };
+
+    // RAII probe-length recorder: counts the groups one operation touches and
+    // folds them into the table's stats whenever the probe returns, no matter
+    // which of the exits it takes
+    class ProbeRecorder
+    {
+    public:
+        explicit ProbeRecorder(TableStatsCounters& stats) noexcept
+            : stats_(stats)
+        {}
+
+        ProbeRecorder(const ProbeRecorder&) = delete;
+
+        ProbeRecorder& operator=(const ProbeRecorder&) = delete;
+
+        ~ProbeRecorder()
+        {
+            stats_.probes.fetch_add(groups_, std::memory_order_relaxed);
+            stats_.operations.fetch_add(1, std::memory_order_relaxed);
+
+            auto seen = stats_.max_probe_length.load(std::memory_order_relaxed);
+
+            while (seen < groups_
+                   && !stats_.max_probe_length.compare_exchange_weak(seen, groups_, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void note_group() noexcept { ++groups_; }
+
+    private:
+        TableStatsCounters& stats_;
+        std::size_t groups_ = 0;
+    };
+#endif
+
+    /// Finds the index of the first full slot at-or-after `index` in a meta
+    /// table of `capacity` bytes, or `capacity` if there is none. Loads 8
+    /// metadata bytes at a time so empty runs cost one word load per 8 slots
+    /// rather than 8 dependent byte loads; full slots are exactly the bytes
+    /// with a clear high bit.
+    [[nodiscard]] inline std::size_t find_next_full_slot(const BucketState* meta,
+        std::size_t capacity,
+        std::size_t index) noexcept
+    {
+        constexpr auto highs = std::uint64_t{0x8080808080808080};
+
+        // capacities are always a whole number of groups (and so a whole number
+        // of words), only the *starting* index can sit mid-word
+        for (auto word_index = index & ~std::size_t{7}; word_index < capacity; word_index += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, meta + word_index, sizeof(word));
+
+            auto full_mask = ~word & highs;
+
+            if (word_index < index)
+            {
+                // first word may cover slots before `index`, ignore those
+                full_mask &= ~std::uint64_t{0} << ((index - word_index) * 8);
+            }
+
+            if (full_mask != 0)
+            {
+                return word_index + (static_cast<std::size_t>(std::countr_zero(full_mask)) >> 3);
+            }
+        }
+
+        return capacity;
+    }
+
+    /// A bitmask over the slots of one probed group, where every matching slot
+    /// contributes exactly one set bit. Iterated with the usual "find lowest
+    /// set bit, clear it" dance.
+    ///
+    /// `Shift` maps a bit position back to a slot index, as the vector and
+    /// SWAR paths put their match bits at different positions (1 bit per byte
+    /// vs. the high bit of each byte).
+    template <typename Mask, unsigned Shift> class GroupMatch
+    {
+    public:
+        explicit constexpr GroupMatch(Mask mask) noexcept
+            : mask_(mask)
+        {}
+
+        /// Checks if any slot in the group matched at all
+        [[nodiscard]] explicit constexpr operator bool() const noexcept { return mask_ != 0; }
+
+        /// Gets the index *within the group* of the lowest matching slot
+        [[nodiscard]] constexpr std::size_t lowest() const noexcept
+        {
+            return static_cast<std::size_t>(std::countr_zero(mask_)) >> Shift;
+        }
+
+        /// Removes the lowest match from the mask, making `lowest()` return the next one
+        constexpr void remove_lowest() noexcept { mask_ &= mask_ - 1; }
+
+    private:
+        Mask mask_;
+    };
+
+#ifdef ZINC_HASH_GROUP_SSE2
+    /// Views 16 metadata bytes at a time, answering "which slots hold state X"
+    /// with a single vector compare instead of up to 16 dependent byte loads.
+    class MetaGroup
+    {
+    public:
+        /// How many metadata bytes are scanned per probe step
+        constexpr static std::size_t width = 16;
+
+        using Match = GroupMatch<std::uint32_t, 0>;
+
+        explicit MetaGroup(const BucketState* meta) noexcept
+            : ctrl_(_mm_loadu_si128(pointer_cast<const __m128i*>(meta)))
+        {}
+
+        /// Gets a mask of every slot in the group whose metadata byte is exactly `state`
+        [[nodiscard]] Match match(BucketState state) const noexcept
+        {
+            const auto splat = _mm_set1_epi8(static_cast<char>(state));
+
+            return Match(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, splat))));
+        }
+
+    private:
+        __m128i ctrl_;
     };
+#elif defined(ZINC_HASH_GROUP_NEON)
+    /// Views 8 metadata bytes at a time, answering "which slots hold state X"
+    /// with a single vector compare instead of 8 dependent byte loads.
+    class MetaGroup
+    {
+    public:
+        /// How many metadata bytes are scanned per probe step
+        constexpr static std::size_t width = 8;
+
+        using Match = GroupMatch<std::uint64_t, 3>;
+
+        explicit MetaGroup(const BucketState* meta) noexcept
+            : ctrl_(vld1_u8(pointer_cast<const std::uint8_t*>(meta)))
+        {}
+
+        /// Gets a mask of every slot in the group whose metadata byte is exactly `state`
+        [[nodiscard]] Match match(BucketState state) const noexcept
+        {
+            const auto splat = vdup_n_u8(static_cast<std::uint8_t>(state));
+            const auto eq = vceq_u8(ctrl_, splat);
+
+            // vceq gives 0xff per matching byte, keep one bit per byte so
+            // `remove_lowest` can clear single matches
+            return Match(vget_lane_u64(vreinterpret_u64_u8(eq), 0) & 0x8080808080808080ULL);
+        }
+
+    private:
+        uint8x8_t ctrl_;
+    };
+#else
+    /// Portable fallback for `MetaGroup`: loads 8 metadata bytes as one word and
+    /// finds matching bytes with the usual SWAR zero-byte trick.
+    class MetaGroup
+    {
+    public:
+        /// How many metadata bytes are scanned per probe step
+        constexpr static std::size_t width = 8;
+
+        using Match = GroupMatch<std::uint64_t, 3>;
+
+        explicit MetaGroup(const BucketState* meta) noexcept { std::memcpy(&ctrl_, meta, sizeof(ctrl_)); }
+
+        /// Gets a mask of every slot in the group whose metadata byte is exactly `state`.
+        ///
+        /// May contain false positives (the borrow in the zero-byte trick can leak
+        /// into the next byte), but the lowest set match is always exact, and callers
+        /// re-check the metadata byte before trusting a non-lowest match.
+        [[nodiscard]] Match match(BucketState state) const noexcept
+        {
+            constexpr auto lows = std::uint64_t{0x0101010101010101};
+            constexpr auto highs = std::uint64_t{0x8080808080808080};
+            const auto x = ctrl_ ^ (lows * static_cast<unsigned char>(state));
+
+            return Match((x - lows) & ~x & highs);
+        }
+
+    private:
+        std::uint64_t ctrl_;
+    };
+#endif
 
     /// Better default hash map than `std::unordered_map`. Implemented using
     /// a hash table (as the name implies), with linear probing. No
@@ -56,6 +388,7 @@ namespace zinc::detail
     template <SetTraits Traits> class RawHashSet
     {
         using Stored = SetSlot<Traits>;
+        using ImmutableStored = SetImmutableSlot<Traits>;
         using RealAlloc = AllocRebind<SetAlloc<Traits>, std::byte>;
 
     public:
@@ -95,6 +428,10 @@ namespace zinc::detail
                 // traits may need to do extra work, e.g with NodeHashSet
                 Traits::copy_to(alloc_ref(), other.value_ptr_to(index), value_ptr_to(index));
             });
+
+            size_ = other.size_;
+            first_full_ = other.first_full_;
+            tombstone_count_ = other.tombstone_count_;
         }
 
         RawHashSet(RawHashSet&& other) noexcept
@@ -103,6 +440,58 @@ namespace zinc::detail
             swap(*this, other);
         }
 
+        /// The small-buffer protocol, see `detail::SmallAdapter`: the adapter
+        /// embeds `n` value-sized chunks of storage in itself and hands them
+        /// to us here, and the table lives inside them until it outgrows them.
+        /// That storage belongs to the adapter and can never change owners,
+        /// which `swap` and the allocation helpers all have to respect.
+        ///
+        /// # Parameters
+        /// - `buffer`: The adapter's inline storage
+        /// - `n`: How many value-sized chunks `buffer` holds
+        RawHashSet(SmallAdapterPlaceholder, AlignedStorageFor<value_type>* buffer, size_type n) noexcept
+            : small_buffer_(pointer_cast<Stored*>(buffer))
+            , small_slots_(n)
+        {
+            const auto capacity = largest_inline_capacity();
+
+            // buffers too small for even one group just degenerate into the
+            // normal heap-on-first-insert behavior
+            if (capacity != 0)
+            {
+                values_ = small_buffer_;
+                meta_ = pointer_cast<BucketState*>(values_ + capacity);
+                capacity_ = capacity;
+                first_full_ = capacity;
+                initialize_meta();
+            }
+        }
+
+        /// Part of the small-buffer protocol: computes how many value-sized
+        /// chunks of inline storage are needed for `n` elements to fit without
+        /// ever spilling to the allocator. The bucket count has to clear both
+        /// the load factor and the group-width floor, and the buffer holds the
+        /// metadata bytes alongside the slots.
+        ///
+        /// # Parameters
+        /// - `n`: The number of elements the inline buffer should hold
+        [[nodiscard]] constexpr static size_type small_buffer_slots(size_type n) noexcept
+        {
+            auto capacity = normalize_capacity(1);
+
+            while (static_cast<float>(n) > static_cast<float>(capacity) * Traits::max_load_factor())
+            {
+                capacity *= 2;
+            }
+
+            return (byte_size(capacity) + sizeof(Stored) - 1) / sizeof(Stored);
+        }
+
+        /// Part of the small-buffer protocol: exposes the start of the current
+        /// allocation so `SmallAdapter::using_small` can tell whether the
+        /// table still lives in the inline buffer
+        [[nodiscard]] const void* raw_storage() const noexcept { return values_; }
+
         explicit RawHashSet(size_type initial_capacity, allocator_type alloc = {})
             : alloc_(alloc)
         {
@@ -129,6 +518,11 @@ namespace zinc::detail
         /// `end()` if the key was not found, an iterator otherwise
         [[nodiscard]] iterator find(const EqComparable<const key_type&, key_equal> auto& key)
         {
+            if (empty())
+            {
+                return end();
+            }
+
             const auto hash_value = hash_key(key);
             const auto [probed_index, state] = probe_for<false>(key, hash_value);
 
@@ -158,6 +552,11 @@ namespace zinc::detail
         /// `end()` if the key was not found, an iterator otherwise
         const_iterator find(const EqComparable<const key_type&, key_equal> auto& key) const
         {
+            if (empty())
+            {
+                return end();
+            }
+
             const auto hash_value = hash_key(key);
             const auto [probed_index, state] = probe_for<false>(key, hash_value);
 
@@ -177,6 +576,82 @@ namespace zinc::detail
         /// `end()` if the key was not found, an iterator otherwise
         [[nodiscard]] const_iterator find(const key_type& key) const { return find<key_type>(key); }
 
+        /// `find` overload that skips hashing entirely: `token` must wrap the
+        /// result of `hash_function()` applied to this same `key`.
+        ///
+        /// # Parameters
+        /// - `token`: The key's hash, precomputed via `hash_function()`
+        /// - `key`: The key to look for
+        ///
+        /// # Returns
+        /// `end()` if the key was not found, an iterator otherwise
+        [[nodiscard]] iterator find(HashToken token, const EqComparable<const key_type&, key_equal> auto& key)
+        {
+            if (empty())
+            {
+                return end();
+            }
+
+            const auto [probed_index, state] = probe_for<false>(key, mix_hash(token.raw()));
+
+            if (state == BucketState::empty)
+                return end();
+            else
+                return iterator_to(probed_index);
+        }
+
+        /// `find` overload that skips hashing entirely: `token` must wrap the
+        /// result of `hash_function()` applied to this same `key`.
+        ///
+        /// # Parameters
+        /// - `token`: The key's hash, precomputed via `hash_function()`
+        /// - `key`: The key to look for
+        ///
+        /// # Returns
+        /// `end()` if the key was not found, an iterator otherwise
+        [[nodiscard]] const_iterator find(HashToken token,
+            const EqComparable<const key_type&, key_equal> auto& key) const
+        {
+            if (empty())
+            {
+                return end();
+            }
+
+            const auto [probed_index, state] = probe_for<false>(key, mix_hash(token.raw()));
+
+            if (state == BucketState::empty)
+                return end();
+            else
+                return iterator_to(probed_index);
+        }
+
+        /// Looks up a whole batch of keys at once, writing one iterator per key
+        /// (`end()` for keys that aren't present) to `out` in input order.
+        ///
+        /// Keys are processed in small windows: a window's worth of hashes is
+        /// computed and the metadata for each home bucket is prefetched before
+        /// any key is actually probed, so the cache misses of a batch overlap
+        /// instead of each lookup stalling on its own cold line.
+        ///
+        /// # Parameters
+        /// - `keys`: The keys to look for
+        /// - `out`: An output iterator that `iterator`s are written through
+        void find_many(std::span<const key_type> keys, std::output_iterator<iterator> auto out)
+        {
+            find_many_impl(*this, keys, out);
+        }
+
+        /// Looks up a whole batch of keys at once, writing one constant iterator
+        /// per key (`end()` for keys that aren't present) to `out` in input order.
+        ///
+        /// # Parameters
+        /// - `keys`: The keys to look for
+        /// - `out`: An output iterator that `const_iterator`s are written through
+        void find_many(std::span<const key_type> keys, std::output_iterator<const_iterator> auto out) const
+        {
+            find_many_impl(*this, keys, out);
+        }
+
         /// Gets the number of elements in the set that are equal to `key`,
         /// either `1` or `0` because duplicate elements are not allowed.
         ///
@@ -292,6 +767,13 @@ namespace zinc::detail
         void insert(std::input_iterator auto first,
             std::input_iterator auto last) requires std::constructible_from<value_type, decltype(*first)>
         {
+            // when the range can be walked twice, size it up front: one rehash at
+            // most instead of log2(distance) full-table moves during the loop
+            if constexpr (std::forward_iterator<decltype(first)>)
+            {
+                reserve(size() + static_cast<size_type>(std::distance(first, last)));
+            }
+
             for (std::input_iterator auto it = first; it != last; ++it)
             {
                 emplace(*it);
@@ -329,29 +811,27 @@ namespace zinc::detail
         {
             rehash_if_required();
 
-            PerfectlySizedStorage<Stored> raw;
+            StorageFor<Stored> raw;
             Traits::construct(alloc_ref(), raw.as(), std::forward<decltype(args)>(args)...);
 
-            const auto& key = Traits::key_from(*raw.as());
-            const auto hash_value = hash_key(key);
-            const auto [index, state] = probe_for<true>(key, hash_value);
+            return insert_constructed(raw, hash_key(Traits::key_from(*raw.as())));
+        }
 
-            // tombstones can get re-used here, no point to leaving them as tombstones
-            // when they'll just add to load_factor & get probed over anyway
-            if (state != BucketState::full)
-            {
-                Traits::transfer_to(alloc_ref(), raw.as(), value_ptr_to(index));
-                update_meta(index, BucketState::full);
+        /// `emplace` overload that skips hashing the key: `token` must wrap the
+        /// result of `hash_function()` applied to the key of the value being
+        /// emplaced, anything else is unpredictable (asserted in debug builds).
+        std::pair<iterator, bool> emplace_with_hash(HashToken token, auto&&... args) //
+            requires std::constructible_from<value_type, decltype(args)...>
+        {
+            rehash_if_required();
 
-                if (state == BucketState::empty)
-                {
-                    ++size_;
-                }
+            StorageFor<Stored> raw;
+            Traits::construct(alloc_ref(), raw.as(), std::forward<decltype(args)>(args)...);
 
-                return {iterator_to(index), true};
-            }
+            assert("token must come from hash_function() over the emplaced key"
+                   && token.raw() == hash_ref()(Traits::key_from(*raw.as())));
 
-            return {iterator_to(index), false};
+            return insert_constructed(raw, mix_hash(token.raw()));
         }
 
         /// Erases a value from the set based off of an iterator position
@@ -361,6 +841,8 @@ namespace zinc::detail
             Traits::destroy(alloc_ref(), value_ptr_to(index));
             update_meta(index, BucketState::tombstone);
             size_ -= 1;
+            tombstone_count_ += 1;
+            note_erased_at(index);
         }
 
         /// Erases an element if one that matches `key` exists
@@ -412,6 +894,57 @@ namespace zinc::detail
         {
             clear_slots();
             initialize_meta();
+            first_full_ = bucket_count();
+            tombstone_count_ = 0;
+        }
+
+        /// Destroys every element and returns the entire allocation to the allocator,
+        /// unlike `clear()` which keeps the slot arrays around for re-use. The set is
+        /// left exactly as if it had just been default-constructed.
+        void clear_and_release()
+        {
+            if (values() == nullptr)
+            {
+                return;
+            }
+
+            destroy_allocation();
+
+            values_ = nullptr;
+            meta_ = nullptr;
+            capacity_ = 0;
+            first_full_ = 0;
+            tombstone_count_ = 0;
+        }
+
+        /// Rehashes down to the smallest capacity that still satisfies the load factor
+        /// for the current `size()`, releasing the rest of the allocation. Does nothing
+        /// when the table is already as small as it can get.
+        ///
+        /// # Effects
+        /// If the table shrinks, every single iterator is invalidated. The entire
+        /// container is re-hashed and every element is moved into a new allocation
+        void shrink_to_fit()
+        {
+            if (values() == nullptr)
+            {
+                return;
+            }
+
+            if (size() == 0)
+            {
+                clear_and_release();
+
+                return;
+            }
+
+            const auto needed = static_cast<float>(size()) / max_load_factor();
+            const auto target = normalize_capacity(static_cast<size_type>(std::ceil(needed)));
+
+            if (target < bucket_count())
+            {
+                rebuild(target);
+            }
         }
 
         /// If `new_size` is over `bucket_count()`, rehashes to have that many buckets. All elements
@@ -427,16 +960,22 @@ namespace zinc::detail
         {
             if (new_size > bucket_count())
             {
-                auto alloc = new_allocation(new_size);
-                transfer_to_new_allocation(alloc);
-                swap_allocation(alloc);
+                rebuild(new_size);
             }
         }
 
-        /// Alias to `rehash`, here for the sake of compatibility with the `unordered_*` APIs
+        /// Ensures that `new_size` elements can be inserted without another rehash, i.e
+        /// rehashes to `ceil(new_size / max_load_factor())` buckets rather than `new_size`
+        /// buckets. Here for the sake of compatibility with the `unordered_*` APIs.
         ///
-        /// Exactly equivalent to `rehash(new_size)`
-        void reserve(size_type new_size) { return rehash(new_size); }
+        /// # Parameters
+        /// - `new_size`: The number of elements to make room for
+        void reserve(size_type new_size)
+        {
+            const auto buckets = static_cast<float>(new_size) / max_load_factor();
+
+            rehash(static_cast<size_type>(std::ceil(buckets)));
+        }
 
         /// Gets the max load factor that the set will get to before it hashes itself.
         ///
@@ -461,14 +1000,10 @@ namespace zinc::detail
         /// Checks if the set is completely empty, equivalent to `set.size() == 0`
         [[nodiscard]] bool empty() const noexcept { return size() == 0; }
 
-        /// Gets an iterator to the first value of the table
-        [[nodiscard]] iterator begin() noexcept
-        {
-            const auto first_full = ranges::find(meta_array(), BucketState::full);
-            const auto index = std::distance(meta_array().begin(), first_full);
-
-            return iterator_to(index);
-        }
+        /// Gets an iterator to the first value of the table. O(1), the index of
+        /// the first full slot is kept up to date by insert/erase instead of
+        /// being searched for here.
+        [[nodiscard]] iterator begin() noexcept { return iterator_to(first_full_); }
 
         /// Gets a past-the-end iterator on the table
         [[nodiscard]] iterator end() noexcept
@@ -479,14 +1014,8 @@ namespace zinc::detail
             return iterator_to(end_index);
         }
 
-        /// Gets a constant iterator to the first element
-        [[nodiscard]] const_iterator begin() const noexcept
-        {
-            const auto first_full = ranges::find(meta_array(), BucketState::full);
-            const auto index = std::distance(meta_array().begin(), first_full);
-
-            return iterator_to(index);
-        }
+        /// Gets a constant iterator to the first element. O(1), see `begin`
+        [[nodiscard]] const_iterator begin() const noexcept { return iterator_to(first_full_); }
 
         /// Gets a constant past-the-end iterator
         [[nodiscard]] const_iterator end() const noexcept
@@ -536,6 +1065,24 @@ namespace zinc::detail
         /// Returns the allocator in use by the container
         [[nodiscard]] key_equal key_eq() const noexcept { return key_equal(eq_ref()); }
 
+#ifdef ZINC_TABLE_STATS
+        /// Gets the statistics accumulated so far: probe counts and lengths,
+        /// rehash count, and the current tombstone count. Only exists when the
+        /// library is built with `ZINC_TABLE_STATS` defined.
+        [[nodiscard]] TableStats stats() const noexcept
+        {
+            TableStats copy;
+
+            copy.probes = stats_.probes.load(std::memory_order_relaxed);
+            copy.operations = stats_.operations.load(std::memory_order_relaxed);
+            copy.max_probe_length = stats_.max_probe_length.load(std::memory_order_relaxed);
+            copy.rehashes = stats_.rehashes.load(std::memory_order_relaxed);
+            copy.tombstones = tombstone_count_;
+
+            return copy;
+        }
+#endif
+
         /// Swaps a set with another set, ADL-compatible and self-swap safe
         ///
         /// # Parameters
@@ -545,7 +1092,14 @@ namespace zinc::detail
         {
             using std::swap;
 
-            if constexpr (AllocTraits<RealAlloc>::propagate_on_container_swap)
+            // an inline table's storage is embedded in its adapter and cannot
+            // change owners, so it gets spilled into a real allocation first.
+            // If allocating here throws, `noexcept` terminates - the usual
+            // trade small-buffer containers make for cheap swaps elsewhere
+            lhs.spill_inline_buffer();
+            rhs.spill_inline_buffer();
+
+            if constexpr (AllocTraits<RealAlloc>::propagate_on_container_swap::value)
             {
                 swap(lhs.alloc_, rhs.alloc_);
             }
@@ -553,8 +1107,15 @@ namespace zinc::detail
             swap(lhs.hash_, rhs.hash_);
             swap(lhs.eq_, rhs.eq_);
             swap(lhs.values_, rhs.values_);
+            swap(lhs.meta_, rhs.meta_);
             swap(lhs.capacity_, rhs.capacity_);
             swap(lhs.size_, rhs.size_);
+            swap(lhs.first_full_, rhs.first_full_);
+            swap(lhs.tombstone_count_, rhs.tombstone_count_);
+
+#ifdef ZINC_TABLE_STATS
+            lhs.stats_.swap_with(rhs.stats_);
+#endif
         }
 
         template <typename Value> struct RawHashSetIterator
@@ -590,7 +1151,12 @@ namespace zinc::detail
                 assert("not past the end" && !is_at_end());
                 assert("has a value" && is_current_full());
 
-                return Traits::value_from(pointer_cast<MaybeConstStored*>(buffer_)[index_]);
+                // `value_from` is defined against the immutable view of the slot (for
+                // maps, `pair<const K, V>` punning the stored `pair<K, V>`); casting
+                // mutability back in is fine since the slot storage is never const
+                const auto& slot = pointer_cast<const ImmutableStored*>(buffer_)[index_];
+
+                return const_cast<reference>(Traits::value_from(slot));
             }
 
             pointer operator->() const noexcept { return std::addressof(**this); }
@@ -611,7 +1177,7 @@ namespace zinc::detail
                 return copy;
             }
 
-            [[nodiscard]] bool operator==(RawHashSetIterator other) noexcept
+            [[nodiscard]] bool operator==(RawHashSetIterator other) const noexcept
             {
                 return other.buffer_ == buffer_ && other.capacity_ == capacity_ && other.index_ == index_;
             }
@@ -624,16 +1190,14 @@ namespace zinc::detail
                 return pointer_cast<const BucketState*>(pointer_cast<const Stored*>(buffer_) + capacity_)[index_];
             }
 
-            [[nodiscard]] bool is_current_full() const noexcept { return current_value() == BucketState::full; }
+            [[nodiscard]] bool is_current_full() const noexcept { return is_full_state(current_value()); }
 
             void find_next_full()
             {
-                ++index_; // get past the current element, prevents an infinite loop
+                const auto* meta = pointer_cast<const BucketState*>(pointer_cast<const Stored*>(buffer_) + capacity_);
 
-                while (!is_at_end() && !is_current_full())
-                {
-                    ++index_;
-                }
+                // +1 gets past the current element, prevents an infinite loop
+                index_ = find_next_full_slot(meta, capacity_, index_ + 1);
             }
 
         private:
@@ -645,50 +1209,223 @@ namespace zinc::detail
         };
 
     protected:
-        // compares `size + 1` to `bucket_count() * max_load_factor()`
-        bool should_resize() noexcept { return size() + 1 > bucket_count() * max_load_factor(); }
+        // compares `size + tombstones + 1` to `bucket_count() * max_load_factor()`.
+        // tombstones get probed over just like live elements do, so they have to
+        // count against the ceiling or long-running churn degrades every lookup
+        // into a near-full table scan
+        bool should_resize() noexcept
+        {
+            return size() + tombstone_count_ + 1 > bucket_count() * max_load_factor();
+        }
+
+        // second half of the emplace family: probes for a home for the
+        // already-constructed value in `raw` (with its mixed hash) and either
+        // transfers it in or drops it on the floor if the key already exists
+        std::pair<iterator, bool> insert_constructed(StorageFor<Stored>& raw, size_type hash_value)
+        {
+            const auto& key = Traits::key_from(*raw.as());
+            const auto [index, state] = probe_for<true>(key, hash_value);
+
+            // tombstones can get re-used here, no point to leaving them as tombstones
+            // when they'll just add to load_factor & get probed over anyway
+            if (state != BucketState::full)
+            {
+                if (state == BucketState::tombstone)
+                {
+                    --tombstone_count_;
+                }
+
+                Traits::transfer_to(alloc_ref(), raw.as(), value_ptr_to(index));
+                update_meta(index, hash_fragment(hash_value));
+                ++size_;
+                note_inserted_at(index);
+
+                return {iterator_to(index), true};
+            }
+
+            // the key already exists, the freshly-constructed duplicate would
+            // otherwise leak
+            Traits::destroy(alloc_ref(), raw.as());
+
+            return {iterator_to(index), false};
+        }
+
+        // shared machinery for the `find_many` overloads, templated over the
+        // const-ness of `self` so both can resolve through the right iterator type
+        static void find_many_impl(auto& self, std::span<const key_type> keys, auto out)
+        {
+            constexpr size_type window = 8;
+
+            if (self.empty())
+            {
+                for (size_type i = 0; i < keys.size(); ++i)
+                {
+                    *out++ = self.end();
+                }
+
+                return;
+            }
+
+            std::array<size_type, window> hashes;
+
+            for (size_type start = 0; start < keys.size(); start += window)
+            {
+                const auto count = std::min(window, keys.size() - start);
+
+                // hash the whole window and get every home bucket's metadata
+                // line moving toward the cache up front...
+                for (size_type i = 0; i < count; ++i)
+                {
+                    hashes[i] = self.hash_key(keys[start + i]);
+                    prefetch_read(self.meta() + home_index(hashes[i], self.bucket_count()));
+                }
+
+                // ...so that by the time each key is probed, its line is
+                // (hopefully) already on the way
+                for (size_type i = 0; i < count; ++i)
+                {
+                    const auto [index, state] = self.template probe_for<false>(keys[start + i], hashes[i]);
+
+                    *out++ = state == BucketState::full ? self.iterator_to(index) : self.end();
+                }
+            }
+        }
+
+        // word-sized set keys (integral IDs, mostly) don't need the
+        // `key_from`/`eq_ref` hops in the probe loop: the slot *is* the key
+        // and equality is the default bitwise one, so the whole check can be
+        // a single register compare. Only the stock equality functors qualify,
+        // a user-provided `KeyEq` always gets called
+        constexpr static bool direct_key_compare = std::same_as<Stored, key_type>
+            && std::equality_comparable<key_type> && std::has_unique_object_representations_v<key_type>
+            && sizeof(key_type) <= sizeof(std::uint64_t)
+            && OneOf<key_equal, EqualTo<key_type>, std::equal_to<key_type>>;
 
         // checks if a bucket is both full and has a key equivalent to `key`
-        bool full_and_key_eq(const key_type& key, BucketState state, size_type index) const
+        bool full_and_key_eq(const auto& key, BucketState state, size_type index) const
         {
-            if (state == BucketState::full)
+            if (!is_full_state(state))
             {
-                return eq_ref()(Traits::key_from(values_at(index)), key);
+                return false;
             }
 
-            return false;
+            // heterogeneous probes still go through the functor, it's the one
+            // that knows how the mixed types compare
+            if constexpr (direct_key_compare && std::same_as<std::remove_cvref_t<decltype(key)>, key_type>)
+            {
+                return values_at(index) == key;
+            }
+            else
+            {
+                return eq_ref()(Traits::key_from(values_at(index)), key);
+            }
         }
 
-        // implements the actual linear probing logic for the hash table
+        // implements the actual probing logic for the hash table, scanning one
+        // `MetaGroup` of metadata per step instead of one slot at a time.
         // `ReturnTombstones` is for methods that do/dont want to get tombstone
         // slots returned, as insertion might want it while find might not (and the
-        // choice should be made at compile time)
+        // choice should be made at compile time).
+        //
+        // takes the key's *raw* hash: the home slot and the 7-bit fragment
+        // to match candidate slots against are both derived from it here.
+        //
+        // probing is done at group granularity: both insertion and lookup scan
+        // every candidate slot of a group before moving on, and insertion never
+        // skips past a group containing an empty slot, so "group has an empty
+        // slot" ends a lookup the same way an empty slot did for the old
+        // slot-at-a-time loop. When the key is found, `BucketState::full` is
+        // returned as the state, never the stored fragment.
         template <bool ReturnTombstones>
         std::pair<size_type, BucketState> probe_for(const EqComparable<const key_type&, key_equal> auto& key,
-            size_type index) const
+            size_type hash) const
         {
+            const auto group_count = bucket_count() / MetaGroup::width;
+            const auto fragment = hash_fragment(hash);
+            auto group = home_index(hash, bucket_count()) / MetaGroup::width;
+
+#ifdef ZINC_TABLE_STATS
+            ProbeRecorder recorder(stats_);
+#endif
+
             while (true)
             {
-                const auto meta = meta_at(index);
+#ifdef ZINC_TABLE_STATS
+                recorder.note_group();
+#endif
 
-                // empty slots can be used, but if the key is found we return this too.
-                // probing happens for both insertion and finding
-                if (meta == BucketState::empty || full_and_key_eq(key, meta, index))
+                const auto base = group * MetaGroup::width;
+                const MetaGroup meta_group(meta() + base);
+
+                // only slots whose stored fragment matches this key's fragment are
+                // worth a real key comparison, everything else is skipped outright
+                for (auto match = meta_group.match(fragment); match; match.remove_lowest())
                 {
-                    return {index, meta};
+                    const auto slot = base + match.lowest();
+
+                    // re-checking `meta_at` here also rejects the portable path's
+                    // rare false positives before they hit an uninitialized slot
+                    if (full_and_key_eq(key, meta_at(slot), slot))
+                    {
+                        return {slot, BucketState::full};
+                    }
                 }
 
                 // if the caller so chooses, it can return tombstone values
                 // as well, useful for insertion
                 if constexpr (ReturnTombstones)
                 {
-                    if (meta == BucketState::tombstone)
+                    if (const auto match = meta_group.match(BucketState::tombstone))
                     {
-                        return {index, meta};
+                        return {base + match.lowest(), BucketState::tombstone};
                     }
                 }
 
-                index = (index + 1) % bucket_count();
+                if (const auto match = meta_group.match(BucketState::empty))
+                {
+                    return {base + match.lowest(), BucketState::empty};
+                }
+
+                group = (group + 1) & (group_count - 1);
+            }
+        }
+
+        // finds the first empty slot in a fresh allocation's meta table, starting
+        // from `index`'s group and probing the same way `probe_for` does. Used
+        // when rehashing, where the destination table has no tombstones and no
+        // duplicate keys to worry about
+        [[nodiscard]] static size_type find_free_slot(const BucketState* meta,
+            size_type capacity,
+            size_type index) noexcept
+        {
+            const auto group_count = capacity / MetaGroup::width;
+            auto group = index / MetaGroup::width;
+
+            while (true)
+            {
+                const auto base = group * MetaGroup::width;
+                const MetaGroup meta_group(meta + base);
+
+                if (const auto match = meta_group.match(BucketState::empty))
+                {
+                    return base + match.lowest();
+                }
+
+                group = (group + 1) & (group_count - 1);
+            }
+        }
+
+        // keeps the cached first-full index up to date when a slot is filled
+        void note_inserted_at(size_type index) noexcept { first_full_ = std::min(first_full_, index); }
+
+        // keeps the cached first-full index up to date when a slot is vacated:
+        // erasing the first element means the next full slot has to be searched
+        // for, everything else leaves the cache untouched
+        void note_erased_at(size_type index) noexcept
+        {
+            if (index == first_full_)
+            {
+                first_full_ = find_next_full_slot(meta(), bucket_count(), index + 1);
             }
         }
 
@@ -708,10 +1445,10 @@ namespace zinc::detail
         void clear_slots()
         {
             for_each_full_slot([this](size_type slot_index) {
-                // in theory the types could be trivial, but because the allocator might have non-dtor side
-                // effects, we need to actually call `AllocTraits::destroy`. If it doesn't, any good optimizer
-                // will remove it anyway (as by default it's `std::destroy_at`, aka `ptr->~T();`
-                AllocTraits<RealAlloc>::destroy(alloc_ref(), value_ptr_to(slot_index));
+                // through the traits rather than `AllocTraits` directly: node-based
+                // traits own storage behind the slot that a raw destroy would leak.
+                // For flat traits this forwards to `AllocTraits::destroy` as before
+                Traits::destroy(alloc_ref(), value_ptr_to(slot_index));
             });
 
             size_ = 0;
@@ -721,24 +1458,94 @@ namespace zinc::detail
         void destroy_allocation()
         {
             clear_slots();
+            release_storage();
+        }
+
+        // gives the current allocation back to the allocator, unless the table
+        // lives in an adapter's inline buffer, which is not ours to free
+        void release_storage()
+        {
+            if (!is_inline())
+            {
+                AllocTraits<RealAlloc>::deallocate(alloc_ref(), underlying_storage(), byte_size());
+            }
+        }
+
+        // checks if the table currently lives in a `SmallAdapter`'s buffer
+        [[nodiscard]] bool is_inline() const noexcept { return values_ != nullptr && values_ == small_buffer_; }
+
+        // the largest (power-of-two) bucket count whose slots and metadata
+        // both fit in the inline buffer, or 0 when there is no such count -
+        // including when there's no inline buffer at all
+        [[nodiscard]] size_type largest_inline_capacity() const noexcept
+        {
+            const auto bytes = small_slots_ * sizeof(Stored);
+            auto capacity = normalize_capacity(1);
+
+            if (small_buffer_ == nullptr || byte_size(capacity) > bytes)
+            {
+                return 0;
+            }
+
+            while (byte_size(capacity * 2) <= bytes)
+            {
+                capacity *= 2;
+            }
+
+            return capacity;
+        }
 
-            AllocTraits<RealAlloc>::deallocate(alloc_ref(), underlying_storage(), byte_size());
+        // moves an inline table into a real allocation, leaving the inline
+        // buffer dead. The one case where storage has to move without the
+        // capacity changing: handing the table to another object
+        void spill_inline_buffer()
+        {
+            if (is_inline())
+            {
+                rebuild(bucket_count());
+            }
         }
 
-        // checks if the table needs to be rehashed, and rehashes if it does
+        // checks if the table needs to be rehashed, and rehashes if it does.
+        // when the ceiling was hit through accumulated tombstones rather than
+        // live elements, the table is rebuilt at its current capacity instead
+        // of doubled: that reclaims the dead slots without growing a table
+        // that's mostly dead space
         void rehash_if_required()
         {
-            if (size() == 0)
+            if (values() == nullptr)
             {
-                rehash(Traits::initial_size());
+                // lazy first allocation. A dead inline buffer (possible after
+                // `clear_and_release` on a small table) is preferred over the
+                // default heap capacity
+                const auto inline_capacity = largest_inline_capacity();
+
+                rehash(inline_capacity != 0 ? inline_capacity : Traits::initial_size());
             }
 
             if (should_resize())
             {
-                rehash(capacity_ * 2);
+                const bool live_over = size() + 1 > bucket_count() * max_load_factor();
+
+                rebuild(live_over ? capacity_ * Traits::growth_factor() : capacity_);
             }
         }
 
+        // rebuilds the table into a fresh allocation of (at least) `new_capacity`
+        // buckets, re-hashing every live element and dropping every tombstone
+        void rebuild(size_type new_capacity)
+        {
+#ifdef ZINC_TABLE_STATS
+            stats_.rehashes.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+            auto alloc = new_allocation(new_capacity);
+            transfer_to_new_allocation(alloc);
+            swap_allocation(alloc);
+            first_full_ = find_next_full_slot(meta(), bucket_count(), 0);
+            tombstone_count_ = 0;
+        }
+
         using Allocation = std::pair<Stored*, size_type>;
 
         void initialize_allocation(size_type initial_capacity) { swap_allocation(new_allocation(initial_capacity)); }
@@ -750,6 +1557,18 @@ namespace zinc::detail
         // does not destruct any elements in the storage, must be done before calling
         Allocation new_allocation(size_type new_capacity)
         {
+            new_capacity = normalize_capacity(new_capacity);
+
+            // a *dead* inline buffer gets first refusal, it's how a released or
+            // moved-from small table finds its way back in. A live one can't be
+            // rebuilt in place, the old table is still sitting in it
+            if (!is_inline() && new_capacity <= largest_inline_capacity())
+            {
+                initialize_meta(pointer_cast<BucketState*>(small_buffer_ + new_capacity), new_capacity);
+
+                return {small_buffer_, new_capacity};
+            }
+
             const auto size = byte_size(new_capacity);
             const auto ptr = pointer_cast<Stored*>(AllocTraits<RealAlloc>::allocate(alloc_ref(), size));
             initialize_meta(pointer_cast<BucketState*>(ptr + new_capacity), new_capacity);
@@ -769,14 +1588,15 @@ namespace zinc::detail
             for_each_full_slot([&](size_type index) {
                 const auto& [alloc, capacity] = new_alloc;
                 const auto& key = Traits::key_from(values_at(index));
-                const auto hash = hash_key_with_count(key, capacity);
+                const auto hash = hash_key(key);
+                const auto slot = find_free_slot(meta, capacity, home_index(hash, capacity));
 
                 if constexpr (Copy)
-                    Traits::copy_to(alloc_ref(), value_ptr_to(index), alloc + hash);
+                    Traits::copy_to(alloc_ref(), value_ptr_to(index), alloc + slot);
                 else
-                    Traits::transfer_to(alloc_ref(), value_ptr_to(index), alloc + hash);
+                    Traits::transfer_to(alloc_ref(), value_ptr_to(index), alloc + slot);
 
-                meta[hash] = BucketState::full;
+                meta[slot] = hash_fragment(hash);
             });
         }
 
@@ -784,25 +1604,22 @@ namespace zinc::detail
 
         void transfer_to_new_allocation(Allocation alloc) { setup_new_allocation<false>(alloc); }
 
-        // deallocates the current allocation and replaces it with a new one.
-        // properly calls destructors on the current allocation
+        // deallocates the current allocation and replaces it with a new one. Slots
+        // must already be dead (transferred out or destroyed) before this is called,
+        // `transfer_to` has always destroyed its source
         void swap_allocation(Allocation new_alloc)
         {
             const auto& [alloc, capacity] = new_alloc;
 
             if (values()) [[likely]]
             {
-                for_each_full_slot([&](size_type index) {
-                    // traits may need to handle calling extra stuff that we dont know about
-                    Traits::destroy(alloc_ref(), value_ptr_to(index));
-                });
-
-                AllocTraits<RealAlloc>::deallocate(alloc_ref(), underlying_storage(), byte_size());
+                release_storage();
             }
 
             values_ = alloc;
             meta_ = pointer_cast<BucketState*>(values() + capacity);
             capacity_ = capacity;
+            first_full_ = capacity;
         }
 
         // initializes the meta table that `this` holds
@@ -821,16 +1638,34 @@ namespace zinc::detail
             }
         }
 
-        // Correctly hashes a key with the current capacity
-        [[nodiscard]] size_type hash_key(const key_type& key) const noexcept
+        // capacities are committed to powers of two (never smaller than one
+        // group) so slot indices come from a mask instead of an integer modulo,
+        // which `probe_for` pays for on every probe step otherwise. Power-of-two
+        // capacities are automatically a whole number of groups, which probing
+        // also relies on
+        [[nodiscard]] constexpr static size_type normalize_capacity(size_type capacity) noexcept
         {
-            return hash_key_with_count(key, bucket_count());
+            return std::bit_ceil(std::max(capacity, MetaGroup::width));
         }
 
-        // Correctly hashes a key with N as the bucket count
-        [[nodiscard]] size_type hash_key_with_count(const key_type& key, size_type capacity) const noexcept
+        // Computes the mixed hash of a key. Slot indices and meta fragments are
+        // both derived from this one value. Deliberately heterogeneous: with a
+        // transparent hasher, a lookup key like `std::string_view` gets hashed
+        // as-is instead of being converted into a temporary `key_type` first
+        [[nodiscard]] size_type hash_key(const auto& key) const noexcept { return mix_hash(hash_ref()(key)); }
+
+        // see `mix_table_hash`: shared with the frozen snapshot views, which
+        // probe the same layout
+        [[nodiscard]] constexpr static size_type mix_hash(size_type hash) noexcept
         {
-            return hash_ref()(key) % capacity;
+            return mix_table_hash(hash);
+        }
+
+        // Maps a mixed hash to its home slot for a given bucket count, which
+        // `normalize_capacity` guarantees is a power of two
+        [[nodiscard]] constexpr static size_type home_index(size_type hash, size_type capacity) noexcept
+        {
+            return hash & (capacity - 1);
         }
 
         // Returns the byte-wise size of the current allocation
@@ -949,7 +1784,7 @@ namespace zinc::detail
             return pointer_cast<const std::byte*>(values());
         }
 
-        [[nodiscard]] bool is_full_at(size_type slot) const noexcept { return meta_at(slot) == BucketState::full; }
+        [[nodiscard]] bool is_full_at(size_type slot) const noexcept { return is_full_state(meta_at(slot)); }
 
         [[nodiscard]] bool is_empty_at(size_type slot) const noexcept { return meta_at(slot) == BucketState::empty; }
 
@@ -969,8 +1804,20 @@ namespace zinc::detail
         //   values_                     meta_
         Stored* values_ = nullptr;
         BucketState* meta_ = nullptr;
+        // the small-buffer protocol: when a `SmallAdapter` embeds our storage,
+        // these describe it. They belong to *this object* rather than to the
+        // table's contents, so swap/copy/move never transfer them
+        Stored* small_buffer_ = nullptr;
+        size_type small_slots_ = 0;
         size_type capacity_ = 0;
         size_type size_ = 0;
+        size_type first_full_ = 0; // index of the first full slot, `capacity_` when there is none
+        size_type tombstone_count_ = 0;
+
+#ifdef ZINC_TABLE_STATS
+        // mutable so const probes (find & friends) can record themselves
+        mutable TableStatsCounters stats_;
+#endif
         [[no_unique_address]] hasher hash_;
         [[no_unique_address]] key_equal eq_;
         [[no_unique_address]] RealAlloc alloc_;
@@ -20,6 +20,7 @@
 #define ZINC_CONTAINERS_DETAIL_SET_TRAITS
 
 #include "zinc/containers/detail/slot_traits.h"
+#include "zinc/containers/table_policy.h"
 #include "zinc/types/concepts.h"
 #include "zinc/types/functors.h"
 
@@ -32,7 +33,8 @@ namespace zinc::detail
         HashFn<K> Hash,
         EqFn<K> Eq,
         Allocator<K> Alloc,
-        SlotTraitsFor<K> SlotTraits = SetSlotTraits<K>>
+        SlotTraitsFor<K> SlotTraits = SetSlotTraits<K>,
+        typename Policy = DefaultTablePolicy>
     struct DefaultSetTraits : SlotTraits
     {
         using SlotTraits::construct;
@@ -63,9 +65,11 @@ namespace zinc::detail
 
         using Allocator = Alloc;
 
-        [[nodiscard]] constexpr static std::size_t initial_size() noexcept { return 32; }
+        [[nodiscard]] constexpr static std::size_t initial_size() noexcept { return Policy::min_capacity; }
 
-        [[nodiscard]] constexpr static float max_load_factor() noexcept { return 0.72f; }
+        [[nodiscard]] constexpr static float max_load_factor() noexcept { return Policy::max_load_factor; }
+
+        [[nodiscard]] constexpr static std::size_t growth_factor() noexcept { return Policy::growth_factor; }
 
         [[nodiscard]] constexpr static const Key& key_from(const SlotValue& slot_value) { return slot_value; }
 
@@ -76,7 +80,7 @@ namespace zinc::detail
     };
 
     template <typename Traits>
-    concept SetTraits = SlotTraitsFor<Traits, typename Traits::Key>
+    concept SetTraits = ValidSlotTraits<Traits>
         // clang-format off
         && requires(const typename Traits::SlotValue& slot, const typename Traits::ImmutableSlotValue& const_slot)
     {
@@ -85,6 +89,7 @@ namespace zinc::detail
         typename Traits::Allocator;
         { Traits::initial_size() } noexcept -> std::convertible_to<std::size_t>;
         { Traits::max_load_factor() } noexcept -> std::same_as<float>;
+        { Traits::growth_factor() } noexcept -> std::convertible_to<std::size_t>;
         { Traits::key_from(slot) } -> std::same_as<const typename Traits::Key&>;
         { Traits::value_from(const_slot) } -> std::same_as<const typename Traits::Value&>;
     };
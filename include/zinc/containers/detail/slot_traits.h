@@ -86,10 +86,11 @@ namespace zinc::detail
         using SlotTraitsHandledTypes = std::tuple<K, V>;
     };
 
-    template <typename Traits, typename K, typename... V>
-    concept SlotTraitsFor = std::same_as<typename Traits::SlotTraitsHandledTypes, std::tuple<K, V...>>
-        // clang-format off
-        && requires(std::allocator<typename Traits::SlotValue> alloc, typename Traits::SlotValue* a,
+    // the operational half of `SlotTraitsFor`: the traits can manage slot
+    // lifetimes, without pinning down exactly which K/V list they were declared for
+    template <typename Traits>
+    // clang-format off
+    concept ValidSlotTraits = requires(std::allocator<typename Traits::SlotValue> alloc, typename Traits::SlotValue* a,
                     typename Traits::SlotValue* b, const typename Traits::SlotValue* c)
     {
         // can't test `construct` without knowing arguments for the types' ctor
@@ -99,6 +100,10 @@ namespace zinc::detail
         { Traits::transfer_to(alloc, a, b) } -> std::same_as<void>;
     };
     // clang-format on
+
+    template <typename Traits, typename K, typename... V>
+    concept SlotTraitsFor = std::same_as<typename Traits::SlotTraitsHandledTypes, std::tuple<K, V...>>
+        && ValidSlotTraits<Traits>;
 } // namespace zinc::detail
 
 #endif
\ No newline at end of file
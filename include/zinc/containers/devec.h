@@ -19,9 +19,19 @@
 #ifndef ZINC_CONTAINERS_DEVEC
 #define ZINC_CONTAINERS_DEVEC
 
+#include "zinc/types/allocators.h"
 #include "zinc/types/functors.h"
+#include "zinc/util/uninitialized.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace zinc
@@ -36,9 +46,463 @@ namespace zinc
     /// expands inward from both ends and doesn't care which end you insert
     /// at more, but it also loses complete contiguity. This type is completely
     /// contiguous but has to do more work it keep it that way.
-    template <typename T, typename Alloc = std::allocator<T>> class DeVec
+    template <typename T, Allocator<T> Alloc = std::allocator<T>> class DeVec
     {
-        //
+        using RealAlloc = AllocRebind<Alloc, T>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using iterator = value_type*;
+        using const_iterator = const value_type*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        DeVec() = default;
+
+        /// Creates a devec holding `count` default-constructed elements
+        ///
+        /// # Parameters
+        /// - `count`: The number of elements to construct
+        explicit DeVec(size_type count, allocator_type alloc = {})
+            : alloc_(alloc)
+        {
+            reserve(count);
+
+            for (auto i = size_type{0}; i < count; ++i)
+            {
+                emplace_back();
+            }
+        }
+
+        /// Creates a devec holding `count` copies of `value`
+        ///
+        /// # Parameters
+        /// - `count`: The number of copies to insert
+        /// - `value`: The value to copy
+        DeVec(size_type count, const T& value, allocator_type alloc = {})
+            : alloc_(alloc)
+        {
+            reserve(count);
+
+            for (auto i = size_type{0}; i < count; ++i)
+            {
+                push_back(value);
+            }
+        }
+
+        /// Creates a devec from the elements in `(first, last]`
+        ///
+        /// # Parameters
+        /// - `first`: A starting iterator
+        /// - `last`: The end iterator to insert up to
+        DeVec(std::input_iterator auto first, std::input_iterator auto last, allocator_type alloc = {}) //
+            requires std::constructible_from<T, decltype(*first)>
+            : alloc_(alloc)
+        {
+            if constexpr (std::forward_iterator<decltype(first)>)
+            {
+                reserve(static_cast<size_type>(std::distance(first, last)));
+            }
+
+            for (auto it = first; it != last; ++it)
+            {
+                emplace_back(*it);
+            }
+        }
+
+        /// Creates a devec from an initializer list, preserving order
+        ///
+        /// # Parameters
+        /// - `init_list`: The list of elements to copy in
+        DeVec(std::initializer_list<T> init_list, allocator_type alloc = {})
+            : DeVec(init_list.begin(), init_list.end(), alloc)
+        {}
+
+        DeVec(const DeVec& other)
+            : alloc_(AllocTraits<RealAlloc>::select_on_container_copy_construction(other.alloc_))
+        {
+            reserve(other.size());
+
+            for (const auto& value : other)
+            {
+                push_back(value);
+            }
+        }
+
+        DeVec(DeVec&& other) noexcept
+            : DeVec()
+        {
+            swap(*this, other);
+        }
+
+        DeVec& operator=(DeVec other)
+        {
+            swap(*this, other);
+
+            return *this;
+        }
+
+        ~DeVec()
+        {
+            clear();
+
+            if (buffer_ != nullptr)
+            {
+                AllocTraits<RealAlloc>::deallocate(alloc_, buffer_, capacity_);
+            }
+        }
+
+        /// Returns the allocator in use by the container
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
+        /// Gets the element at `index`, throwing `std::out_of_range` when
+        /// `index >= size()`
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] reference at(size_type index)
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("DeVec: index was out of range");
+            }
+
+            return (*this)[index];
+        }
+
+        /// Gets the element at `index`, throwing `std::out_of_range` when
+        /// `index >= size()`
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] const_reference at(size_type index) const
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("DeVec: index was out of range");
+            }
+
+            return (*this)[index];
+        }
+
+        /// Gets the element at `index` with no bounds checking
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] reference operator[](size_type index) noexcept
+        {
+            assert("index in bounds" && index < size());
+
+            return buffer_[front_ + index];
+        }
+
+        /// Gets the element at `index` with no bounds checking
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] const_reference operator[](size_type index) const noexcept
+        {
+            assert("index in bounds" && index < size());
+
+            return buffer_[front_ + index];
+        }
+
+        /// Gets the first element of the devec
+        [[nodiscard]] reference front() noexcept { return (*this)[0]; }
+
+        /// Gets the first element of the devec
+        [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+
+        /// Gets the last element of the devec
+        [[nodiscard]] reference back() noexcept { return (*this)[size() - 1]; }
+
+        /// Gets the last element of the devec
+        [[nodiscard]] const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+        /// Gets a pointer to the (fully contiguous) element array
+        [[nodiscard]] pointer data() noexcept { return buffer_ + front_; }
+
+        /// Gets a pointer to the (fully contiguous) element array
+        [[nodiscard]] const_pointer data() const noexcept { return buffer_ + front_; }
+
+        [[nodiscard]] iterator begin() noexcept { return data(); }
+
+        [[nodiscard]] const_iterator begin() const noexcept { return data(); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+
+        [[nodiscard]] iterator end() noexcept { return data() + size(); }
+
+        [[nodiscard]] const_iterator end() const noexcept { return data() + size(); }
+
+        [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        /// Checks whether the devec holds no elements
+        [[nodiscard]] bool empty() const noexcept { return front_ == back_; }
+
+        /// Gets the current number of elements in the devec
+        [[nodiscard]] size_type size() const noexcept { return back_ - front_; }
+
+        /// Gets the total number of slots in the allocation, counting the
+        /// slack on both sides of the elements
+        [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+        /// Ensures that at least `new_size` total elements fit without the
+        /// allocation growing. Newly gained slack is split across both ends.
+        ///
+        /// # Parameters
+        /// - `new_size`: The number of elements to make room for
+        void reserve(size_type new_size)
+        {
+            if (new_size > capacity())
+            {
+                relocate(std::max(new_size, minimum_capacity));
+            }
+        }
+
+        /// Destroys every element, leaving the buffer in place for re-use
+        void clear() noexcept
+        {
+            for (auto i = front_; i < back_; ++i)
+            {
+                AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + i);
+            }
+
+            front_ = back_ = capacity_ / 2;
+        }
+
+        /// Copies `value` onto the back of the devec
+        ///
+        /// # Parameters
+        /// - `value`: The value to copy
+        void push_back(const T& value) { emplace_back(value); }
+
+        /// Moves `value` onto the back of the devec
+        ///
+        /// # Parameters
+        /// - `value`: The value to move
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        /// Constructs an element in-place at the back of the devec
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the element from
+        ///
+        /// # Returns
+        /// A reference to the newly-constructed element
+        reference emplace_back(auto&&... args) requires std::constructible_from<T, decltype(args)...>
+        {
+            if (back_ == capacity_)
+            {
+                rebalance();
+            }
+
+            AllocTraits<RealAlloc>::construct(alloc_, buffer_ + back_, std::forward<decltype(args)>(args)...);
+
+            return buffer_[back_++];
+        }
+
+        /// Copies `value` onto the front of the devec
+        ///
+        /// # Parameters
+        /// - `value`: The value to copy
+        void push_front(const T& value) { emplace_front(value); }
+
+        /// Moves `value` onto the front of the devec
+        ///
+        /// # Parameters
+        /// - `value`: The value to move
+        void push_front(T&& value) { emplace_front(std::move(value)); }
+
+        /// Constructs an element in-place at the front of the devec
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the element from
+        ///
+        /// # Returns
+        /// A reference to the newly-constructed element
+        reference emplace_front(auto&&... args) requires std::constructible_from<T, decltype(args)...>
+        {
+            if (front_ == 0)
+            {
+                rebalance();
+            }
+
+            AllocTraits<RealAlloc>::construct(alloc_, buffer_ + (front_ - 1), std::forward<decltype(args)>(args)...);
+
+            return buffer_[--front_];
+        }
+
+        /// Destroys the last element of the devec
+        void pop_back() noexcept
+        {
+            assert("devec is non-empty" && !empty());
+
+            AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + (back_ - 1));
+            --back_;
+        }
+
+        /// Destroys the first element of the devec
+        void pop_front() noexcept
+        {
+            assert("devec is non-empty" && !empty());
+
+            AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + front_);
+            ++front_;
+        }
+
+        /// Grows or shrinks the devec to hold exactly `count` elements,
+        /// default-constructing at (or destroying from) the back
+        ///
+        /// # Parameters
+        /// - `count`: The new size
+        void resize(size_type count)
+        {
+            while (size() > count)
+            {
+                pop_back();
+            }
+
+            reserve(count);
+
+            while (size() < count)
+            {
+                emplace_back();
+            }
+        }
+
+        [[nodiscard]] bool operator==(const DeVec& other) const
+        {
+            return size() == other.size() && std::equal(begin(), end(), other.begin());
+        }
+
+        /// Swaps a devec with another devec, ADL-compatible and self-swap safe
+        ///
+        /// # Parameters
+        /// - `lhs`: The first devec
+        /// - `rhs`: The devec to swap with `lhs`
+        friend void swap(DeVec& lhs, DeVec& rhs) noexcept
+        {
+            using std::swap;
+
+            if constexpr (AllocTraits<RealAlloc>::propagate_on_container_swap::value)
+            {
+                swap(lhs.alloc_, rhs.alloc_);
+            }
+
+            swap(lhs.buffer_, rhs.buffer_);
+            swap(lhs.capacity_, rhs.capacity_);
+            swap(lhs.front_, rhs.front_);
+            swap(lhs.back_, rhs.back_);
+        }
+
+    private:
+        // a push ran out of room on its end of the allocation. If enough total
+        // slack is left to make shifting worthwhile, recenter in place,
+        // otherwise grow into a fresh (centered) allocation
+        void rebalance()
+        {
+            if (worth_recentering())
+            {
+                recenter();
+            }
+            else
+            {
+                relocate(std::max(capacity_ * 2, minimum_capacity));
+            }
+        }
+
+        // shifting is O(size()), so it only pays off when it buys a decent
+        // number of pushes before the next shift. A quarter of the allocation
+        // in slack keeps the amortized cost per push constant even when every
+        // insertion lands on the same end
+        [[nodiscard]] bool worth_recentering() const noexcept
+        {
+            return capacity_ - size() >= capacity_ / 4 && capacity_ - size() >= 2;
+        }
+
+        // re-centers the elements inside the current allocation. Shifting within
+        // one buffer overlaps, so the trivial path is a single memmove and the
+        // generic path constructs in whichever direction is safe for the overlap
+        void recenter()
+        {
+            const auto count = size();
+            const auto new_front = (capacity_ - count) / 2;
+
+            if (new_front == front_)
+            {
+                return;
+            }
+
+            if constexpr (is_trivially_relocatable<T>)
+            {
+                std::memmove(buffer_ + new_front, buffer_ + front_, count * sizeof(T));
+            }
+            else if (new_front < front_)
+            {
+                for (auto i = size_type{0}; i < count; ++i)
+                {
+                    AllocTraits<RealAlloc>::construct(alloc_, buffer_ + new_front + i, std::move(buffer_[front_ + i]));
+                    AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + front_ + i);
+                }
+            }
+            else
+            {
+                for (auto i = count; i > 0; --i)
+                {
+                    AllocTraits<RealAlloc>::construct(alloc_,
+                        buffer_ + new_front + (i - 1),
+                        std::move(buffer_[front_ + (i - 1)]));
+                    AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + front_ + (i - 1));
+                }
+            }
+
+            front_ = new_front;
+            back_ = new_front + count;
+        }
+
+        // moves everything into a fresh allocation of `new_capacity` slots with
+        // the elements centered, so both ends start with equal slack
+        void relocate(size_type new_capacity)
+        {
+            const auto count = size();
+            const auto new_front = (new_capacity - count) / 2;
+            auto* buffer = AllocTraits<RealAlloc>::allocate(alloc_, new_capacity);
+
+            if (buffer_ != nullptr)
+            {
+                uninitialized_relocate_n(alloc_, buffer_ + front_, count, buffer + new_front);
+                AllocTraits<RealAlloc>::deallocate(alloc_, buffer_, capacity_);
+            }
+
+            buffer_ = buffer;
+            capacity_ = new_capacity;
+            front_ = new_front;
+            back_ = new_front + count;
+        }
+
+        constexpr static size_type minimum_capacity = 8;
+
+        [[no_unique_address]] RealAlloc alloc_;
+        T* buffer_ = nullptr;
+        size_type capacity_ = 0;
+        size_type front_ = 0;
+        size_type back_ = 0;
     };
 } // namespace zinc
 
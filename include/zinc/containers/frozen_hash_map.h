@@ -0,0 +1,424 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_FROZEN_HASH_MAP
+#define ZINC_CONTAINERS_FROZEN_HASH_MAP
+
+#include "zinc/containers/detail/raw_hash_set.h"
+#include "zinc/containers/hash_map.h"
+#include "zinc/io/file.h"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace zinc
+{
+    namespace detail
+    {
+        struct SnapshotCorruptPlaceholder
+        {};
+
+        struct SnapshotMismatchPlaceholder
+        {};
+
+        /// The header at the front of every table snapshot. Everything is
+        /// native-endian and native-layout: a snapshot is a startup cache
+        /// for the machines that wrote it, not an interchange format.
+        struct SnapshotHeader
+        {
+            std::uint64_t magic;
+            /// Bumped whenever the default hash, the table's mixer, or the
+            /// probe order changes: an old snapshot must be rebuilt from
+            /// source data, never misread
+            std::uint64_t version;
+            /// `MetaGroup::width` of the writer. Insertion's "never probes
+            /// past a group with an empty slot" invariant is per-group, so a
+            /// reader scanning differently-sized groups would start probes
+            /// mid-group and miss keys
+            std::uint64_t group_width;
+            std::uint64_t bucket_count;
+            std::uint64_t size;
+            std::uint64_t slot_size;
+            /// Byte offset of the slot array, aligned for the slot type
+            /// (mapping bases are page-aligned, so offset alignment is
+            /// in-memory alignment)
+            std::uint64_t slot_offset;
+        };
+
+        // "zincsnap", read as a little-endian u64
+        constexpr inline std::uint64_t snapshot_magic = 0x70616E73636E697AULL;
+
+        constexpr inline std::uint64_t snapshot_version = 1;
+
+        [[nodiscard]] constexpr std::uint64_t snapshot_slot_offset(std::uint64_t bucket_count,
+            std::size_t slot_align) noexcept
+        {
+            const auto meta_end = sizeof(SnapshotHeader) + bucket_count;
+
+            return (meta_end + slot_align - 1) / slot_align * slot_align;
+        }
+    } // namespace detail
+
+    /// Thrown when loading a snapshot file that isn't one, was truncated, or
+    /// was written by an incompatible build/key type and would be misread
+    class BadSnapshot : public std::logic_error
+    {
+    public:
+        explicit BadSnapshot(detail::SnapshotCorruptPlaceholder, const std::filesystem::path& file)
+            : logic_error("File '" + file.string() + "' is not a valid table snapshot!")
+        {}
+
+        explicit BadSnapshot(detail::SnapshotMismatchPlaceholder, const std::filesystem::path& file)
+            : logic_error("Snapshot '" + file.string()
+                          + "' was written by an incompatible build or with different key/value types!")
+        {}
+    };
+
+    /// Checks that a key/value pair can round-trip through a byte-for-byte
+    /// snapshot: both have to be trivially copyable (no pointers worth
+    /// following, no destructors worth running)
+    template <typename K, typename V>
+    concept Snapshottable = std::is_trivially_copyable_v<K>&& std::is_trivially_copyable_v<V>;
+
+    /// Dumps a `HashMap`'s exact table layout - metadata array plus slot
+    /// array - to a file that `FrozenHashMap` can map back in and probe in
+    /// place, skipping the per-entry rebuild entirely. Throws
+    /// `BadFileOperation` if the file can't be written.
+    ///
+    /// # Parameters
+    /// - `map`: The map to snapshot
+    /// - `path`: Where to write the snapshot (truncated if it exists)
+    template <typename Key,
+        typename Value,
+        HashFn<Key> Hash,
+        EqFn<Key> Eq,
+        Allocator<std::pair<const Key, Value>> Alloc,
+        typename Policy>
+    requires Snapshottable<Key, Value>
+    void save_snapshot(const HashMap<Key, Value, Hash, Eq, Alloc, Policy>& map, const std::filesystem::path& path)
+    {
+        using Slot = std::pair<Key, Value>;
+
+        auto header = detail::SnapshotHeader{};
+        header.magic = detail::snapshot_magic;
+        header.version = detail::snapshot_version;
+        header.group_width = detail::MetaGroup::width;
+        header.bucket_count = map.bucket_count();
+        header.size = map.size();
+        header.slot_size = sizeof(Slot);
+        header.slot_offset = detail::snapshot_slot_offset(header.bucket_count, alignof(Slot));
+
+        auto out = std::ofstream(path, std::ios_base::binary | std::ios_base::trunc);
+
+        if (!out.is_open())
+        {
+            throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path);
+        }
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        // an empty map has no allocation at all, the header alone says so
+        if (header.bucket_count != 0)
+        {
+            // the allocation is [ slots | meta ], both `bucket_count` long. On
+            // disk meta goes first so only the slot array needs alignment padding
+            const auto* slots = static_cast<const char*>(map.raw_storage());
+            const auto* meta = slots + header.bucket_count * sizeof(Slot);
+            const auto padding = header.slot_offset - sizeof(header) - header.bucket_count;
+
+            out.write(meta, static_cast<std::streamsize>(header.bucket_count));
+
+            for (auto i = std::uint64_t{0}; i < padding; ++i)
+            {
+                out.put('\0');
+            }
+
+            out.write(slots, static_cast<std::streamsize>(header.bucket_count * sizeof(Slot)));
+        }
+
+        if (!out)
+        {
+            throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path);
+        }
+    }
+
+    /// A read-only `HashMap` view over a memory-mapped snapshot file. Loading
+    /// is an `mmap` plus on-demand page faults instead of re-inserting every
+    /// entry, so a multi-gigabyte table is usable before most of it has been
+    /// read off disk. Probes run directly against the mapped metadata and
+    /// slot arrays, with the exact same group-at-a-time scan the live table
+    /// uses.
+    ///
+    /// The hash and equality functors must be the ones the writing map used,
+    /// and since nothing is deserialized, snapshots only load on the
+    /// architecture/build family that wrote them - `BadSnapshot` catches the
+    /// detectable mismatches (magic, version, group width, slot size), not
+    /// semantic ones like a differently-seeded user hash.
+    template <typename Key,
+        typename Value,
+        HashFn<Key> Hash = zinc::Hash<Key>,
+        EqFn<Key> Eq = zinc::EqualTo<Key>>
+    requires Snapshottable<Key, Value>
+    class FrozenHashMap
+    {
+        using Slot = std::pair<Key, Value>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = Slot;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = Eq;
+        using reference = const value_type&;
+        using const_reference = const value_type&;
+        using pointer = const value_type*;
+        using const_pointer = const value_type*;
+
+        /// An iterator over the full slots of the snapshot, in table order
+        class const_iterator
+        {
+        public:
+            using value_type = Slot;
+            using reference = const Slot&;
+            using pointer = const Slot*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            const_iterator() = default;
+
+            [[nodiscard]] reference operator*() const noexcept { return slots_[index_]; }
+
+            [[nodiscard]] pointer operator->() const noexcept { return slots_ + index_; }
+
+            const_iterator& operator++() noexcept
+            {
+                index_ = detail::find_next_full_slot(meta_, capacity_, index_ + 1);
+
+                return *this;
+            }
+
+            const_iterator operator++(int) noexcept
+            {
+                auto copy = *this;
+
+                ++*this;
+
+                return copy;
+            }
+
+            [[nodiscard]] bool operator==(const const_iterator& other) const noexcept
+            {
+                return index_ == other.index_;
+            }
+
+        private:
+            friend class FrozenHashMap;
+
+            const_iterator(const detail::BucketState* meta,
+                const Slot* slots,
+                size_type capacity,
+                size_type index) noexcept
+                : meta_(meta)
+                , slots_(slots)
+                , capacity_(capacity)
+                , index_(index)
+            {}
+
+            const detail::BucketState* meta_ = nullptr;
+            const Slot* slots_ = nullptr;
+            size_type capacity_ = 0;
+            size_type index_ = 0;
+        };
+
+        using iterator = const_iterator;
+
+        /// Maps the snapshot at `path` and validates its header. Throws
+        /// `BadFileOpen` if the file can't be mapped at all and `BadSnapshot`
+        /// if it maps but isn't a usable snapshot for this instantiation.
+        ///
+        /// # Parameters
+        /// - `path`: The snapshot file to map
+        explicit FrozenHashMap(std::filesystem::path path)
+            : file_(map_file(std::move(path), MappedAccess::random))
+        {
+            auto header = detail::SnapshotHeader{};
+
+            if (file_.size() < sizeof(header))
+            {
+                throw BadSnapshot(detail::SnapshotCorruptPlaceholder{}, file_.path());
+            }
+
+            std::memcpy(&header, file_.data(), sizeof(header));
+
+            if (header.magic != detail::snapshot_magic)
+            {
+                throw BadSnapshot(detail::SnapshotCorruptPlaceholder{}, file_.path());
+            }
+
+            if (header.version != detail::snapshot_version || header.group_width != detail::MetaGroup::width
+                || header.slot_size != sizeof(Slot))
+            {
+                throw BadSnapshot(detail::SnapshotMismatchPlaceholder{}, file_.path());
+            }
+
+            // probe_for masks with `bucket_count - 1` and walks whole groups,
+            // both of which are only sound for the capacities a live table can
+            // actually have. A fabricated count like 24 would pass every check
+            // above and then send probes past the real meta array - reject it
+            // here, where throwing BadSnapshot is still an option
+            if (header.bucket_count != 0
+                && (!std::has_single_bit(header.bucket_count) || header.bucket_count % detail::MetaGroup::width != 0))
+            {
+                throw BadSnapshot(detail::SnapshotCorruptPlaceholder{}, file_.path());
+            }
+
+            const auto expected_end = header.slot_offset + header.bucket_count * sizeof(Slot);
+
+            if (header.slot_offset != detail::snapshot_slot_offset(header.bucket_count, alignof(Slot))
+                || file_.size() < expected_end)
+            {
+                throw BadSnapshot(detail::SnapshotCorruptPlaceholder{}, file_.path());
+            }
+
+            bucket_count_ = header.bucket_count;
+            size_ = header.size;
+            meta_ = pointer_cast<const detail::BucketState*>(file_.data() + sizeof(header));
+            slots_ = pointer_cast<const Slot*>(file_.data() + header.slot_offset);
+        }
+
+        /// Gets the number of entries in the snapshot
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+
+        /// Checks whether the snapshot holds no entries
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /// Gets the snapshotted table's capacity
+        [[nodiscard]] size_type bucket_count() const noexcept { return bucket_count_; }
+
+        /// Gets an iterator to the first entry (in table order, not
+        /// insertion order)
+        [[nodiscard]] const_iterator begin() const noexcept
+        {
+            const auto first = bucket_count_ == 0
+                                   ? size_type{0}
+                                   : detail::find_next_full_slot(meta_, bucket_count_, 0);
+
+            return const_iterator(meta_, slots_, bucket_count_, first);
+        }
+
+        /// Gets the past-the-end iterator
+        [[nodiscard]] const_iterator end() const noexcept
+        {
+            return const_iterator(meta_, slots_, bucket_count_, bucket_count_);
+        }
+
+        /// Probes the mapped table for `key`. Heterogeneous like the live
+        /// table's lookups: anything the hasher/equality pair accept works
+        /// without materializing a `key_type`.
+        ///
+        /// # Parameters
+        /// - `key`: The key to look up
+        ///
+        /// # Returns
+        /// An iterator to the matching entry, or `end()` if there is none
+        [[nodiscard]] const_iterator find(const EqComparable<const Key&, Eq> auto& key) const noexcept
+        {
+            const auto index = probe_for(key);
+
+            return index == bucket_count_ ? end() : const_iterator(meta_, slots_, bucket_count_, index);
+        }
+
+        /// Checks if the snapshot contains an entry for `key`
+        [[nodiscard]] bool contains(const EqComparable<const Key&, Eq> auto& key) const noexcept
+        {
+            return probe_for(key) != bucket_count_;
+        }
+
+        /// Gets the value mapped to `key`, throwing `std::out_of_range` when
+        /// the snapshot has no such entry
+        [[nodiscard]] const Value& at(const EqComparable<const Key&, Eq> auto& key) const
+        {
+            const auto index = probe_for(key);
+
+            if (index == bucket_count_)
+            {
+                throw std::out_of_range("zinc::FrozenHashMap::at: key not in snapshot");
+            }
+
+            return slots_[index].second;
+        }
+
+    private:
+        // `probe_for<false>` minus mutation concerns: scan group metadata for
+        // fragment matches, stop at the first group with an empty slot.
+        // Returns `bucket_count_` when the key isn't present.
+        [[nodiscard]] size_type probe_for(const auto& key) const noexcept
+        {
+            if (bucket_count_ == 0)
+            {
+                return bucket_count_;
+            }
+
+            const auto mixed = detail::mix_table_hash(hash_(key));
+            const auto fragment = detail::hash_fragment(mixed);
+            const auto group_count = bucket_count_ / detail::MetaGroup::width;
+            auto group = (mixed & (bucket_count_ - 1)) / detail::MetaGroup::width;
+
+            while (true)
+            {
+                const auto base = group * detail::MetaGroup::width;
+                const detail::MetaGroup meta_group(meta_ + base);
+
+                for (auto match = meta_group.match(fragment); match; match.remove_lowest())
+                {
+                    const auto slot = base + match.lowest();
+
+                    // re-checking the byte rejects the portable path's rare
+                    // false positives, same as the live table
+                    if (meta_[slot] == fragment && eq_(slots_[slot].first, key))
+                    {
+                        return slot;
+                    }
+                }
+
+                if (meta_group.match(detail::BucketState::empty))
+                {
+                    return bucket_count_;
+                }
+
+                group = (group + 1) & (group_count - 1);
+            }
+        }
+
+        MappedFile file_;
+        size_type bucket_count_ = 0;
+        size_type size_ = 0;
+        const detail::BucketState* meta_ = nullptr;
+        const Slot* slots_ = nullptr;
+        [[no_unique_address]] Hash hash_;
+        [[no_unique_address]] Eq eq_;
+    };
+} // namespace zinc
+
+#endif
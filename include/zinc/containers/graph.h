@@ -19,14 +19,180 @@
 #ifndef ZINC_CONTAINERS_GRAPH
 #define ZINC_CONTAINERS_GRAPH
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace zinc
 {
+    template <typename T> class GraphBuilder;
+
+    /// A directed graph in compressed-sparse-row (CSR) form: every node's
+    /// outgoing edges live next to each other in one contiguous edge array,
+    /// with a per-node offset array saying where each run starts. Traversal
+    /// is pure sequential reads, which is the entire reason this exists -
+    /// adjacency-list-of-vectors graphs chase a pointer per node instead.
+    ///
+    /// The layout is immutable: graphs are assembled through `GraphBuilder`
+    /// and frozen by `build()`. Node payloads (the `T`s) stay mutable.
     template <typename T> class Graph
     {
-        //
+    public:
+        /// Nodes are dense indices handed out by the builder; 32 bits keeps
+        /// the edge array at half the footprint of `std::size_t` ids
+        using node_type = std::uint32_t;
+
+        Graph() = default;
+
+        /// Gets the number of nodes in the graph
+        [[nodiscard]] std::size_t node_count() const noexcept { return values_.size(); }
+
+        /// Gets the total number of edges in the graph
+        [[nodiscard]] std::size_t edge_count() const noexcept { return edges_.size(); }
+
+        /// Gets the nodes that `node` has an edge pointing to, in the order
+        /// the edges were added to the builder
+        ///
+        /// # Parameters
+        /// - `node`: The node whose outgoing edges to look up
+        [[nodiscard]] std::span<const node_type> neighbors(node_type node) const noexcept
+        {
+            assert("node is in the graph" && node < node_count());
+
+            return {edges_.data() + offsets_[node], offsets_[node + 1] - offsets_[node]};
+        }
+
+        /// Gets the number of outgoing edges `node` has
+        ///
+        /// # Parameters
+        /// - `node`: The node whose edges to count
+        [[nodiscard]] std::size_t out_degree(node_type node) const noexcept { return neighbors(node).size(); }
+
+        /// Gets the value stored on `node`
+        ///
+        /// # Parameters
+        /// - `node`: The node whose value to get
+        [[nodiscard]] T& operator[](node_type node) noexcept
+        {
+            assert("node is in the graph" && node < node_count());
+
+            return values_[node];
+        }
+
+        /// Gets the value stored on `node`
+        ///
+        /// # Parameters
+        /// - `node`: The node whose value to get
+        [[nodiscard]] const T& operator[](node_type node) const noexcept
+        {
+            assert("node is in the graph" && node < node_count());
+
+            return values_[node];
+        }
+
+    private:
+        friend class GraphBuilder<T>;
+
+        Graph(std::vector<T> values, std::vector<std::size_t> offsets, std::vector<node_type> edges) noexcept
+            : values_(std::move(values))
+            , offsets_(std::move(offsets))
+            , edges_(std::move(edges))
+        {}
+
+        std::vector<T> values_;
+        std::vector<std::size_t> offsets_; // node_count() + 1 entries, [i, i+1) indexes into edges_
+        std::vector<node_type> edges_;
+    };
+
+    /// Assembles a `Graph<T>` out of incremental `add_node`/`add_edge` calls.
+    ///
+    /// Edges are buffered as flat (from, to) pairs, and `build()` compresses
+    /// them in two linear passes: count every node's out-degree, prefix-sum
+    /// the counts into the offset array, then drop each edge into its node's
+    /// run. No per-node allocations happen anywhere in the process.
+    template <typename T> class GraphBuilder
+    {
+    public:
+        using node_type = typename Graph<T>::node_type;
+
+        GraphBuilder() = default;
+
+        /// Adds a node carrying `value` to the graph being built
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the node's value from
+        ///
+        /// # Returns
+        /// The id of the new node, usable in `add_edge` immediately
+        node_type add_node(auto&&... args) requires std::constructible_from<T, decltype(args)...>
+        {
+            values_.emplace_back(std::forward<decltype(args)>(args)...);
+
+            return static_cast<node_type>(values_.size() - 1);
+        }
+
+        /// Adds a directed edge between two previously-added nodes
+        ///
+        /// # Parameters
+        /// - `from`: The node the edge leaves
+        /// - `to`: The node the edge points at
+        void add_edge(node_type from, node_type to)
+        {
+            assert("both endpoints are in the graph" && from < values_.size() && to < values_.size());
+
+            edges_.emplace_back(from, to);
+        }
+
+        /// Hints at how many edges will be added, so the edge buffer only
+        /// allocates once
+        ///
+        /// # Parameters
+        /// - `count`: The expected number of `add_edge` calls
+        void reserve_edges(std::size_t count) { edges_.reserve(count); }
+
+        /// Compresses everything added so far into a frozen `Graph`, leaving
+        /// the builder empty and re-usable
+        ///
+        /// # Returns
+        /// The finished CSR graph
+        [[nodiscard]] Graph<T> build()
+        {
+            std::vector<std::size_t> offsets(values_.size() + 1, 0);
+            std::vector<node_type> compressed(edges_.size());
+
+            // pass one: out-degree of every node, shifted up a slot so the
+            // prefix sum below lands each node's *starting* offset at its index
+            for (const auto& [from, to] : edges_)
+            {
+                ++offsets[from + 1];
+            }
+
+            for (auto i = std::size_t{1}; i < offsets.size(); ++i)
+            {
+                offsets[i] += offsets[i - 1];
+            }
+
+            // pass two: drop each edge at its node's cursor. Walking the edge
+            // buffer in insertion order keeps each node's neighbor run stable
+            auto cursors = offsets;
+
+            for (const auto& [from, to] : edges_)
+            {
+                compressed[cursors[from]++] = to;
+            }
+
+            edges_.clear();
+
+            return Graph<T>(std::exchange(values_, {}), std::move(offsets), std::move(compressed));
+        }
+
+    private:
+        std::vector<T> values_;
+        std::vector<std::pair<node_type, node_type>> edges_;
     };
 } // namespace zinc
 
@@ -0,0 +1,253 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_GRAPH_ALGORITHMS
+#define ZINC_CONTAINERS_GRAPH_ALGORITHMS
+
+#include "zinc/containers/graph.h"
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace zinc
+{
+    /// The distance `bfs_distances` reports for nodes the search never reached
+    inline constexpr std::size_t unreachable_distance = std::numeric_limits<std::size_t>::max();
+
+    namespace detail
+    {
+        // frontiers below this size are processed on the calling thread;
+        // spawning workers for a handful of nodes costs more than it saves
+        inline constexpr std::size_t parallel_frontier_threshold = 2048;
+
+        [[nodiscard]] inline std::size_t worker_count(std::size_t requested) noexcept
+        {
+            if (requested != 0)
+            {
+                return requested;
+            }
+
+            const auto hardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+
+            return hardware == 0 ? 1 : hardware;
+        }
+
+        // runs `f(chunk, worker)` over `workers` contiguous slices of `nodes`,
+        // on `workers` threads. Falls back to the calling thread when the batch
+        // is too small for the spawn overhead to pay for itself
+        template <typename NodeType, typename Fn>
+        void for_each_frontier_chunk(std::span<const NodeType> nodes, std::size_t workers, Fn f)
+        {
+            if (workers <= 1 || nodes.size() < parallel_frontier_threshold)
+            {
+                f(nodes, std::size_t{0});
+
+                return;
+            }
+
+            const auto per_worker = (nodes.size() + workers - 1) / workers;
+            std::vector<std::thread> threads;
+            threads.reserve(workers);
+
+            for (auto worker = std::size_t{0}; worker < workers; ++worker)
+            {
+                const auto begin = std::min(worker * per_worker, nodes.size());
+                const auto length = std::min(per_worker, nodes.size() - begin);
+
+                threads.emplace_back([=] { f(nodes.subspan(begin, length), worker); });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        // splices every worker's local output onto `into`, clearing the locals
+        // for the next round
+        template <typename NodeType>
+        void merge_local_frontiers(std::vector<std::vector<NodeType>>& locals, std::vector<NodeType>& into)
+        {
+            into.clear();
+
+            for (auto& local : locals)
+            {
+                into.insert(into.end(), local.begin(), local.end());
+                local.clear();
+            }
+        }
+    } // namespace detail
+
+    /// Computes the BFS distance from `source` to every node in the graph,
+    /// expanding each frontier in parallel. Nodes are claimed with a
+    /// compare-and-swap on their distance slot, so every node is visited
+    /// exactly once even when several workers reach it in the same level.
+    ///
+    /// # Parameters
+    /// - `graph`: The graph to search
+    /// - `source`: The node to measure distances from
+    /// - `workers`: How many threads to expand frontiers with, `0` meaning
+    ///   one per hardware thread
+    ///
+    /// # Returns
+    /// One distance per node, with `unreachable_distance` for nodes the
+    /// search never reached
+    template <typename T>
+    [[nodiscard]] std::vector<std::size_t> bfs_distances(const Graph<T>& graph,
+        typename Graph<T>::node_type source,
+        std::size_t workers = 0)
+    {
+        using node_type = typename Graph<T>::node_type;
+
+        const auto worker_count = detail::worker_count(workers);
+        std::vector<std::atomic<std::size_t>> distances(graph.node_count());
+
+        for (auto& distance : distances)
+        {
+            distance.store(unreachable_distance, std::memory_order_relaxed);
+        }
+
+        distances[source].store(0, std::memory_order_relaxed);
+
+        std::vector<node_type> frontier = {source};
+        std::vector<node_type> next;
+        std::vector<std::vector<node_type>> locals(worker_count);
+
+        for (auto level = std::size_t{0}; !frontier.empty(); ++level)
+        {
+            detail::for_each_frontier_chunk(std::span<const node_type>(frontier),
+                worker_count,
+                [&](std::span<const node_type> chunk, std::size_t worker) {
+                    auto& local = locals[worker];
+
+                    for (auto node : chunk)
+                    {
+                        for (auto neighbor : graph.neighbors(node))
+                        {
+                            auto expected = unreachable_distance;
+
+                            // first worker to flip the slot owns the node
+                            if (distances[neighbor].compare_exchange_strong(expected,
+                                    level + 1,
+                                    std::memory_order_relaxed))
+                            {
+                                local.push_back(neighbor);
+                            }
+                        }
+                    }
+                });
+
+            detail::merge_local_frontiers(locals, next);
+            frontier.swap(next);
+        }
+
+        std::vector<std::size_t> result(distances.size());
+
+        for (auto i = std::size_t{0}; i < distances.size(); ++i)
+        {
+            result[i] = distances[i].load(std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    /// Topologically sorts `graph` with Kahn's algorithm, draining each batch
+    /// of ready (in-degree zero) nodes in parallel. In-degrees are atomic, so
+    /// workers can decrement a shared successor without coordinating; whoever
+    /// drops a counter to zero schedules that node into the next batch.
+    ///
+    /// # Parameters
+    /// - `graph`: The graph to sort
+    /// - `workers`: How many threads to drain batches with, `0` meaning one
+    ///   per hardware thread
+    ///
+    /// # Returns
+    /// Every node in an order where edges only point forward, or `std::nullopt`
+    /// if the graph has a cycle
+    template <typename T>
+    [[nodiscard]] std::optional<std::vector<typename Graph<T>::node_type>> topological_sort(const Graph<T>& graph,
+        std::size_t workers = 0)
+    {
+        using node_type = typename Graph<T>::node_type;
+
+        const auto worker_count = detail::worker_count(workers);
+        std::vector<std::atomic<std::size_t>> in_degrees(graph.node_count());
+
+        for (auto node = node_type{0}; node < graph.node_count(); ++node)
+        {
+            for (auto neighbor : graph.neighbors(node))
+            {
+                in_degrees[neighbor].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        std::vector<node_type> ready;
+        std::vector<node_type> next;
+        std::vector<std::vector<node_type>> locals(worker_count);
+
+        for (auto node = node_type{0}; node < graph.node_count(); ++node)
+        {
+            if (in_degrees[node].load(std::memory_order_relaxed) == 0)
+            {
+                ready.push_back(node);
+            }
+        }
+
+        std::vector<node_type> order;
+        order.reserve(graph.node_count());
+
+        while (!ready.empty())
+        {
+            order.insert(order.end(), ready.begin(), ready.end());
+
+            detail::for_each_frontier_chunk(std::span<const node_type>(ready),
+                worker_count,
+                [&](std::span<const node_type> chunk, std::size_t worker) {
+                    auto& local = locals[worker];
+
+                    for (auto node : chunk)
+                    {
+                        for (auto neighbor : graph.neighbors(node))
+                        {
+                            if (in_degrees[neighbor].fetch_sub(1, std::memory_order_relaxed) == 1)
+                            {
+                                local.push_back(neighbor);
+                            }
+                        }
+                    }
+                });
+
+            detail::merge_local_frontiers(locals, next);
+            ready.swap(next);
+        }
+
+        if (order.size() != graph.node_count())
+        {
+            // something never hit in-degree zero: a cycle
+            return std::nullopt;
+        }
+
+        return order;
+    }
+} // namespace zinc
+
+#endif
@@ -20,6 +20,7 @@
 #define ZINC_CONTAINERS_HASH_MAP
 
 #include "zinc/containers/detail/raw_hash_map.h"
+#include "zinc/containers/detail/small_adapter.h"
 #include "zinc/types/functors.h"
 #include <functional>
 #include <memory>
@@ -29,8 +30,8 @@ namespace zinc
 {
     namespace detail
     {
-        template <typename K, typename V, typename H, typename E, typename A>
-        using HashMapTraits = DefaultMapTraits<K, V, H, E, A>;
+        template <typename K, typename V, typename H, typename E, typename A, typename P = DefaultTablePolicy>
+        using HashMapTraits = DefaultMapTraits<K, V, H, E, A, MapSlotTraits<K, V>, P>;
     }
 
     /// Better default hash map than `std::unordered_map`. Implemented using
@@ -39,14 +40,20 @@ namespace zinc
     /// accesses. `NodeHashMap` exists when stability is needed for both key
     /// and value, and when only value stability is needed, something like
     /// a `HashMap<K, std::unique_ptr<V>>` works just fine.
+    ///
+    /// The load factor, growth factor and initial capacity all come from
+    /// `Policy` at compile time, see `TablePolicy` for when the defaults are
+    /// the wrong trade
     template <typename Key,
         typename Value,
         HashFn<Key> Hash = zinc::Hash<Key>,
         EqFn<Key> Eq = zinc::EqualTo<Key>,
-        Allocator<std::pair<const Key, Value>> Allocator = std::allocator<std::pair<const Key, Value>>>
-    class HashMap : private detail::RawHashMap<detail::DefaultMapTraits<Key, Value, Hash, Eq, Allocator>>
+        Allocator<std::pair<const Key, Value>> Allocator = std::allocator<std::pair<const Key, Value>>,
+        typename Policy = DefaultTablePolicy>
+    class HashMap
+        : private detail::RawHashMap<detail::HashMapTraits<Key, Value, Hash, Eq, Allocator, Policy>>
     {
-        using Traits = detail::DefaultMapTraits<Key, Value, Hash, Eq, Allocator>;
+        using Traits = detail::HashMapTraits<Key, Value, Hash, Eq, Allocator, Policy>;
         using Base = detail::RawHashMap<Traits>;
 
     public:
@@ -85,6 +92,10 @@ namespace zinc
 
         using Base::clear;
 
+        using Base::clear_and_release;
+
+        using Base::shrink_to_fit;
+
         using Base::at;
 
         using Base::operator[];
@@ -93,6 +104,8 @@ namespace zinc
 
         using Base::emplace;
 
+        using Base::emplace_with_hash;
+
         using Base::emplace_hint;
 
         using Base::try_emplace;
@@ -107,6 +120,8 @@ namespace zinc
 
         using Base::find;
 
+        using Base::find_many;
+
         using Base::contains;
 
         using Base::bucket_count;
@@ -123,8 +138,29 @@ namespace zinc
 
         using Base::key_eq;
 
+        using Base::raw_storage;
+
+        using Base::small_buffer_slots;
+
+#ifdef ZINC_TABLE_STATS
+        using Base::stats;
+#endif
+
         using Base::operator==;
     };
+
+    /// `HashMap` whose storage for (roughly) `N` entries lives in a buffer
+    /// inside the map object itself - zero allocator traffic until the table
+    /// outgrows it. See `SmallHashSet` for when this pays off.
+    template <typename Key,
+        typename Value,
+        std::size_t N,
+        HashFn<Key> Hash = zinc::Hash<Key>,
+        EqFn<Key> Eq = zinc::EqualTo<Key>,
+        Allocator<std::pair<const Key, Value>> Alloc = std::allocator<std::pair<const Key, Value>>,
+        typename Policy = DefaultTablePolicy>
+    using SmallHashMap = detail::SmallAdapter<HashMap<Key, Value, Hash, Eq, Alloc, Policy>,
+        HashMap<Key, Value, Hash, Eq, Alloc, Policy>::small_buffer_slots(N)>;
 } // namespace zinc
 
 #endif
\ No newline at end of file
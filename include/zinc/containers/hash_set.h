@@ -20,6 +20,7 @@
 #define ZINC_CONTAINERS_HASH_SET
 
 #include "zinc/containers/detail/raw_hash_set.h"
+#include "zinc/containers/detail/small_adapter.h"
 #include "zinc/types/functors.h"
 #include <functional>
 #include <memory>
@@ -31,13 +32,20 @@ namespace zinc
     /// a flat hash table with linear probing. No separate chaining, no stability
     /// for values, but no indirection on accesses. `NodeHashMap` exists when
     /// stability is needed for the key.
+    ///
+    /// The load factor, growth factor and initial capacity all come from
+    /// `Policy` at compile time, see `TablePolicy` for when the defaults are
+    /// the wrong trade
     template <typename Key,
-        typename Hash = std::hash<Key>,
+        typename Hash = zinc::Hash<Key>,
         typename Eq = zinc::EqualTo<Key>,
-        typename Allocator = std::allocator<Key>>
-    class HashSet : private detail::RawHashSet<detail::DefaultSetTraits<Key, Hash, Eq, Allocator>>
+        typename Allocator = std::allocator<Key>,
+        typename Policy = DefaultTablePolicy>
+    class HashSet
+        : private detail::RawHashSet<
+              detail::DefaultSetTraits<Key, Hash, Eq, Allocator, detail::SetSlotTraits<Key>, Policy>>
     {
-        using Traits = detail::DefaultSetTraits<Key, Hash, Eq, Allocator>;
+        using Traits = detail::DefaultSetTraits<Key, Hash, Eq, Allocator, detail::SetSlotTraits<Key>, Policy>;
         using Base = detail::RawHashSet<Traits>;
 
     public:
@@ -75,10 +83,16 @@ namespace zinc
 
         using Base::clear;
 
+        using Base::clear_and_release;
+
+        using Base::shrink_to_fit;
+
         using Base::insert;
 
         using Base::emplace;
 
+        using Base::emplace_with_hash;
+
         using Base::emplace_hint;
 
         using Base::erase;
@@ -91,6 +105,8 @@ namespace zinc
 
         using Base::find;
 
+        using Base::find_many;
+
         using Base::contains;
 
         using Base::bucket_count;
@@ -107,8 +123,29 @@ namespace zinc
 
         using Base::key_eq;
 
+        using Base::raw_storage;
+
+        using Base::small_buffer_slots;
+
+#ifdef ZINC_TABLE_STATS
+        using Base::stats;
+#endif
+
         using Base::operator==;
     };
+
+    /// `HashSet` whose storage for (roughly) `N` elements lives in a buffer
+    /// inside the set object itself - zero allocator traffic until the table
+    /// outgrows it. For the "millions of tiny sets" pattern, where the heap
+    /// allocation behind each set costs more than every probe combined.
+    template <typename Key,
+        std::size_t N,
+        typename Hash = zinc::Hash<Key>,
+        typename Eq = zinc::EqualTo<Key>,
+        typename Allocator = std::allocator<Key>,
+        typename Policy = DefaultTablePolicy>
+    using SmallHashSet = detail::SmallAdapter<HashSet<Key, Hash, Eq, Allocator, Policy>,
+        HashSet<Key, Hash, Eq, Allocator, Policy>::small_buffer_slots(N)>;
 } // namespace zinc
 
 #endif
\ No newline at end of file
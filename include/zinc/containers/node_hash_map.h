@@ -0,0 +1,147 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_NODE_HASH_MAP
+#define ZINC_CONTAINERS_NODE_HASH_MAP
+
+#include "zinc/containers/detail/node_map_traits.h"
+#include "zinc/containers/detail/raw_hash_map.h"
+#include "zinc/types/allocators/pool.h"
+#include "zinc/types/functors.h"
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace zinc
+{
+    /// The pointer-stable sibling of `HashMap`: the table itself stores only
+    /// node pointers, so rehashing shuffles pointers while every key and value
+    /// stays exactly where it was constructed. References and pointers into the
+    /// map survive any amount of insertion - what intern tables and anything
+    /// else that hands out long-lived references need.
+    ///
+    /// Nodes come out of a `PoolAllocator` by default, one real allocation per
+    /// few thousand nodes, instead of the malloc-per-node that makes
+    /// `std::unordered_map` miserable for insertion-heavy workloads. Probing
+    /// and iteration pay one extra indirection over `HashMap`; prefer `HashMap`
+    /// whenever stability doesn't matter.
+    template <typename Key,
+        typename Value,
+        HashFn<Key> Hash = zinc::Hash<Key>,
+        EqFn<Key> Eq = zinc::EqualTo<Key>,
+        Allocator<std::pair<const Key, Value>> Allocator = PoolAllocator<std::pair<Key, Value>>,
+        typename Policy = DefaultTablePolicy>
+    class NodeHashMap
+        : private detail::RawHashMap<
+              detail::NodeMapTraits<Key, Value, Hash, Eq, Allocator, detail::NodeMapSlotTraits<Key, Value>, Policy>>
+    {
+        using Traits =
+            detail::NodeMapTraits<Key, Value, Hash, Eq, Allocator, detail::NodeMapSlotTraits<Key, Value>, Policy>;
+        using Base = detail::RawHashMap<Traits>;
+
+    public:
+        using key_type = typename Base::key_type;
+        using value_type = typename Base::value_type;
+        using mapped_type = typename Base::mapped_type;
+        using size_type = typename Base::size_type;
+        using difference_type = typename Base::difference_type;
+        using hasher = typename Base::hasher;
+        using key_equal = typename Base::key_equal;
+        using allocator_type = typename Base::allocator_type;
+        using reference = typename Base::reference;
+        using const_reference = typename Base::const_reference;
+        using pointer = typename Base::pointer;
+        using const_pointer = typename Base::const_pointer;
+        using iterator = typename Base::iterator;
+        using const_iterator = typename Base::const_iterator;
+
+        using Base::Base;
+
+        using Base::operator=;
+
+        using Base::get_allocator;
+
+        using Base::begin;
+
+        using Base::end;
+
+        using Base::cbegin;
+
+        using Base::cend;
+
+        using Base::empty;
+
+        using Base::size;
+
+        using Base::clear;
+
+        using Base::clear_and_release;
+
+        using Base::shrink_to_fit;
+
+        using Base::at;
+
+        using Base::operator[];
+
+        using Base::insert;
+
+        using Base::emplace;
+
+        using Base::emplace_with_hash;
+
+        using Base::emplace_hint;
+
+        using Base::try_emplace;
+
+        using Base::erase;
+
+        using Base::extract;
+
+        using Base::merge;
+
+        using Base::count;
+
+        using Base::find;
+
+        using Base::find_many;
+
+        using Base::contains;
+
+        using Base::bucket_count;
+
+        using Base::load_factor;
+
+        using Base::max_load_factor;
+
+        using Base::rehash;
+
+        using Base::reserve;
+
+        using Base::hash_function;
+
+        using Base::key_eq;
+
+#ifdef ZINC_TABLE_STATS
+        using Base::stats;
+#endif
+
+        using Base::operator==;
+    };
+} // namespace zinc
+
+#endif
@@ -19,25 +19,121 @@
 #ifndef ZINC_CONTAINERS_RING_DEQUE
 #define ZINC_CONTAINERS_RING_DEQUE
 
+#include "zinc/types/allocators.h"
 #include "zinc/types/functors.h"
+#include <algorithm>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <functional>
+#include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 namespace zinc
 {
     namespace detail
     {
-        template <typename T> struct RingDequeIterator
+        // random-access iterator over the *logical* order of a ring: it walks
+        // indices 0..size and maps each through the head offset and capacity
+        // mask, so callers never see the wraparound point
+        template <typename T, typename Value> struct RingDequeIterator
         {
-            RingDequeIterator& operator++() noexcept {}
+            using MaybeConstBuffer = std::conditional_t<std::is_const_v<Value>, const T*, T*>;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::remove_const_t<Value>;
+            using reference = Value&;
+            using pointer = Value*;
+            using difference_type = std::ptrdiff_t;
 
-            T* buffer;
-            T* head;
-            T* tail;
-            std::size_t index;
+            RingDequeIterator() = default;
+
+            RingDequeIterator(MaybeConstBuffer buffer, std::size_t mask, std::size_t head, std::size_t index) noexcept
+                : buffer_(buffer)
+                , mask_(mask)
+                , head_(head)
+                , index_(index)
+            {}
+
+            reference operator*() const noexcept { return buffer_[(head_ + index_) & mask_]; }
+
+            pointer operator->() const noexcept { return std::addressof(**this); }
+
+            reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+            RingDequeIterator& operator++() noexcept
+            {
+                ++index_;
+
+                return *this;
+            }
+
+            RingDequeIterator operator++(int) noexcept
+            {
+                const auto copy = *this;
+                ++index_;
+
+                return copy;
+            }
+
+            RingDequeIterator& operator--() noexcept
+            {
+                --index_;
+
+                return *this;
+            }
+
+            RingDequeIterator operator--(int) noexcept
+            {
+                const auto copy = *this;
+                --index_;
+
+                return copy;
+            }
+
+            RingDequeIterator& operator+=(difference_type offset) noexcept
+            {
+                index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + offset);
+
+                return *this;
+            }
+
+            RingDequeIterator& operator-=(difference_type offset) noexcept { return *this += -offset; }
+
+            friend RingDequeIterator operator+(RingDequeIterator it, difference_type offset) noexcept
+            {
+                return it += offset;
+            }
+
+            friend RingDequeIterator operator+(difference_type offset, RingDequeIterator it) noexcept
+            {
+                return it += offset;
+            }
+
+            friend RingDequeIterator operator-(RingDequeIterator it, difference_type offset) noexcept
+            {
+                return it -= offset;
+            }
+
+            friend difference_type operator-(const RingDequeIterator& lhs, const RingDequeIterator& rhs) noexcept
+            {
+                return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+            }
+
+            bool operator==(const RingDequeIterator& other) const noexcept { return index_ == other.index_; }
+
+            auto operator<=>(const RingDequeIterator& other) const noexcept { return index_ <=> other.index_; }
+
+        private:
+            MaybeConstBuffer buffer_ = nullptr;
+            std::size_t mask_ = 0;
+            std::size_t head_ = 0;
+            std::size_t index_ = 0;
         };
     } // namespace detail
 
@@ -46,19 +142,484 @@ namespace zinc
     ///
     /// Able to be a drop-in replacement for `std::deque<T>` if desired.
     ///
-    /// Implements a deque with a ring buffer approach, with insertion
-    /// starting at both ends and gradually moving inward.
+    /// Implements a deque with a ring buffer approach: one contiguous
+    /// power-of-two sized buffer with masked head/tail indices, so pushes
+    /// and pops at either end are O(1) with none of `std::deque`'s block
+    /// chunking. Unlike `std::deque`, pushes *do* invalidate iterators
+    /// and references when they force the ring to grow.
     template <typename T, Allocator<T> Alloc = std::allocator<T>> class RingDeque
     {
+        using RealAlloc = AllocRebind<Alloc, T>;
+
     public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using iterator = detail::RingDequeIterator<T, T>;
+        using const_iterator = detail::RingDequeIterator<T, const T>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
         RingDeque() = default;
 
+        /// Creates a deque holding `count` default-constructed elements
+        ///
+        /// # Parameters
+        /// - `count`: The number of elements to construct
+        explicit RingDeque(size_type count, allocator_type alloc = {})
+            : alloc_(alloc)
+        {
+            grow_to(count);
+
+            for (auto i = size_type{0}; i < count; ++i)
+            {
+                emplace_back();
+            }
+        }
+
+        /// Creates a deque holding `count` copies of `value`
+        ///
+        /// # Parameters
+        /// - `count`: The number of copies to insert
+        /// - `value`: The value to copy
+        RingDeque(size_type count, const T& value, allocator_type alloc = {})
+            : alloc_(alloc)
+        {
+            grow_to(count);
+
+            for (auto i = size_type{0}; i < count; ++i)
+            {
+                push_back(value);
+            }
+        }
+
+        /// Creates a deque from the elements in `(first, last]`
+        ///
+        /// # Parameters
+        /// - `first`: A starting iterator
+        /// - `last`: The end iterator to insert up to
+        RingDeque(std::input_iterator auto first, std::input_iterator auto last, allocator_type alloc = {}) //
+            requires std::constructible_from<T, decltype(*first)>
+            : alloc_(alloc)
+        {
+            if constexpr (std::forward_iterator<decltype(first)>)
+            {
+                grow_to(static_cast<size_type>(std::distance(first, last)));
+            }
+
+            for (auto it = first; it != last; ++it)
+            {
+                emplace_back(*it);
+            }
+        }
+
+        /// Creates a deque from an initializer list, preserving order
+        ///
+        /// # Parameters
+        /// - `init_list`: The list of elements to copy in
+        RingDeque(std::initializer_list<T> init_list, allocator_type alloc = {})
+            : RingDeque(init_list.begin(), init_list.end(), alloc)
+        {}
+
+        RingDeque(const RingDeque& other)
+            : alloc_(AllocTraits<RealAlloc>::select_on_container_copy_construction(other.alloc_))
+        {
+            grow_to(other.size());
+
+            for (const auto& value : other)
+            {
+                push_back(value);
+            }
+        }
+
+        RingDeque(RingDeque&& other) noexcept
+            : RingDeque()
+        {
+            swap(*this, other);
+        }
+
+        RingDeque& operator=(RingDeque other)
+        {
+            swap(*this, other);
+
+            return *this;
+        }
+
+        ~RingDeque()
+        {
+            clear();
+
+            if (buffer_ != nullptr)
+            {
+                AllocTraits<RealAlloc>::deallocate(alloc_, buffer_, capacity_);
+            }
+        }
+
+        /// Returns the allocator in use by the container
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
+        /// Gets the element at `index`, throwing `std::out_of_range` when
+        /// `index >= size()`
+        ///
+        /// # Parameters
+        /// - `index`: The logical index to look up, `0` being the front
+        [[nodiscard]] reference at(size_type index)
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("RingDeque: index was out of range");
+            }
+
+            return (*this)[index];
+        }
+
+        /// Gets the element at `index`, throwing `std::out_of_range` when
+        /// `index >= size()`
+        ///
+        /// # Parameters
+        /// - `index`: The logical index to look up, `0` being the front
+        [[nodiscard]] const_reference at(size_type index) const
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("RingDeque: index was out of range");
+            }
+
+            return (*this)[index];
+        }
+
+        /// Gets the element at `index` with no bounds checking
+        ///
+        /// # Parameters
+        /// - `index`: The logical index to look up, `0` being the front
+        [[nodiscard]] reference operator[](size_type index) noexcept
+        {
+            assert("index in bounds" && index < size());
+
+            return buffer_[slot(index)];
+        }
+
+        /// Gets the element at `index` with no bounds checking
+        ///
+        /// # Parameters
+        /// - `index`: The logical index to look up, `0` being the front
+        [[nodiscard]] const_reference operator[](size_type index) const noexcept
+        {
+            assert("index in bounds" && index < size());
+
+            return buffer_[slot(index)];
+        }
+
+        /// Gets the first element in the deque
+        [[nodiscard]] reference front() noexcept { return (*this)[0]; }
+
+        /// Gets the first element in the deque
+        [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+
+        /// Gets the last element in the deque
+        [[nodiscard]] reference back() noexcept { return (*this)[size() - 1]; }
+
+        /// Gets the last element in the deque
+        [[nodiscard]] const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+        [[nodiscard]] iterator begin() noexcept { return iterator(buffer_, mask(), head_, 0); }
+
+        [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(buffer_, mask(), head_, 0); }
+
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+
+        [[nodiscard]] iterator end() noexcept { return iterator(buffer_, mask(), head_, size()); }
+
+        [[nodiscard]] const_iterator end() const noexcept { return const_iterator(buffer_, mask(), head_, size()); }
+
+        [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        /// Checks whether the deque holds no elements
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /// Gets the current number of elements in the deque
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+
+        /// Gets the number of elements the ring can hold before it has to grow
+        [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+        /// Ensures that at least `new_size` elements fit without the ring growing.
+        /// Capacities are always powers of two, so this rounds up.
+        ///
+        /// # Parameters
+        /// - `new_size`: The number of elements to make room for
+        void reserve(size_type new_size)
+        {
+            if (new_size > capacity())
+            {
+                grow_to(new_size);
+            }
+        }
+
+        /// Destroys every element, leaving the buffer in place for re-use
+        void clear() noexcept
+        {
+            for (auto i = size_type{0}; i < size_; ++i)
+            {
+                AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + slot(i));
+            }
+
+            head_ = 0;
+            size_ = 0;
+        }
+
+        /// Copies `value` onto the back of the deque
+        ///
+        /// # Parameters
+        /// - `value`: The value to copy
+        void push_back(const T& value) { emplace_back(value); }
+
+        /// Moves `value` onto the back of the deque
+        ///
+        /// # Parameters
+        /// - `value`: The value to move
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        /// Constructs an element in-place at the back of the deque
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the element from
+        ///
+        /// # Returns
+        /// A reference to the newly-constructed element
+        reference emplace_back(auto&&... args) requires std::constructible_from<T, decltype(args)...>
+        {
+            grow_if_full();
+
+            const auto index = slot(size_);
+            AllocTraits<RealAlloc>::construct(alloc_, buffer_ + index, std::forward<decltype(args)>(args)...);
+            ++size_;
+
+            return buffer_[index];
+        }
+
+        /// Copies `value` onto the front of the deque
+        ///
+        /// # Parameters
+        /// - `value`: The value to copy
+        void push_front(const T& value) { emplace_front(value); }
+
+        /// Moves `value` onto the front of the deque
+        ///
+        /// # Parameters
+        /// - `value`: The value to move
+        void push_front(T&& value) { emplace_front(std::move(value)); }
+
+        /// Constructs an element in-place at the front of the deque
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the element from
+        ///
+        /// # Returns
+        /// A reference to the newly-constructed element
+        reference emplace_front(auto&&... args) requires std::constructible_from<T, decltype(args)...>
+        {
+            grow_if_full();
+
+            head_ = (head_ - 1) & mask();
+            AllocTraits<RealAlloc>::construct(alloc_, buffer_ + head_, std::forward<decltype(args)>(args)...);
+            ++size_;
+
+            return buffer_[head_];
+        }
+
+        /// Destroys the last element of the deque
+        void pop_back() noexcept
+        {
+            assert("deque is non-empty" && !empty());
+
+            --size_;
+            AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + slot(size_));
+        }
+
+        /// Destroys the first element of the deque
+        void pop_front() noexcept
+        {
+            assert("deque is non-empty" && !empty());
+
+            AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + head_);
+            head_ = (head_ + 1) & mask();
+            --size_;
+        }
+
+        /// Appends a whole batch of elements at once. For trivially copyable
+        /// `T` the batch lands in at most two `memcpy`s (one on each side of
+        /// the wraparound point) instead of an element-at-a-time loop.
+        ///
+        /// # Parameters
+        /// - `values`: The elements to append, in order
+        void push_back_n(std::span<const T> values)
+        {
+            if (values.empty())
+            {
+                return;
+            }
+
+            reserve(size() + values.size());
+
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                const auto tail = slot(size_);
+                const auto until_wrap = std::min(values.size(), capacity_ - tail);
+
+                std::memcpy(buffer_ + tail, values.data(), until_wrap * sizeof(T));
+                std::memcpy(buffer_, values.data() + until_wrap, (values.size() - until_wrap) * sizeof(T));
+
+                size_ += values.size();
+            }
+            else
+            {
+                for (const auto& value : values)
+                {
+                    push_back(value);
+                }
+            }
+        }
+
+        /// Destroys the first `count` elements of the deque. For trivially
+        /// destructible `T` this is nothing but an index bump.
+        ///
+        /// # Parameters
+        /// - `count`: The number of elements to pop, must be `<= size()`
+        void pop_front_n(size_type count) noexcept
+        {
+            assert("cannot pop more elements than are held" && count <= size());
+
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                for (auto i = size_type{0}; i < count; ++i)
+                {
+                    AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + slot(i));
+                }
+            }
+
+            head_ = (head_ + count) & mask();
+            size_ -= count;
+        }
+
+        /// Grows or shrinks the deque to hold exactly `count` elements,
+        /// default-constructing at (or destroying from) the back
+        ///
+        /// # Parameters
+        /// - `count`: The new size
+        void resize(size_type count)
+        {
+            while (size() > count)
+            {
+                pop_back();
+            }
+
+            reserve(count);
+
+            while (size() < count)
+            {
+                emplace_back();
+            }
+        }
+
+        [[nodiscard]] bool operator==(const RingDeque& other) const
+        {
+            return size() == other.size() && std::equal(begin(), end(), other.begin());
+        }
+
+        /// Swaps a deque with another deque, ADL-compatible and self-swap safe
+        ///
+        /// # Parameters
+        /// - `lhs`: The first deque
+        /// - `rhs`: The deque to swap with `lhs`
+        friend void swap(RingDeque& lhs, RingDeque& rhs) noexcept
+        {
+            using std::swap;
+
+            if constexpr (AllocTraits<RealAlloc>::propagate_on_container_swap::value)
+            {
+                swap(lhs.alloc_, rhs.alloc_);
+            }
+
+            swap(lhs.buffer_, rhs.buffer_);
+            swap(lhs.capacity_, rhs.capacity_);
+            swap(lhs.head_, rhs.head_);
+            swap(lhs.size_, rhs.size_);
+        }
+
     private:
-        [[no_unique_address]] Alloc alloc_;
-        T* start_ = nullptr;
-        T* end_ = nullptr;
-        T* head_ = nullptr;
-        T* tail_ = nullptr;
+        [[nodiscard]] size_type mask() const noexcept { return capacity_ - 1; }
+
+        [[nodiscard]] size_type slot(size_type index) const noexcept { return (head_ + index) & mask(); }
+
+        void grow_if_full()
+        {
+            if (size_ == capacity_)
+            {
+                grow_to(capacity_ == 0 ? initial_capacity : capacity_ * 2);
+            }
+        }
+
+        // moves everything into a fresh power-of-two buffer, linearized so the
+        // new head sits at index 0. For trivially copyable types the two halves
+        // of the ring move with one memcpy each
+        void grow_to(size_type new_capacity)
+        {
+            new_capacity = std::bit_ceil(std::max(new_capacity, initial_capacity));
+
+            if (new_capacity <= capacity_)
+            {
+                return;
+            }
+
+            auto* buffer = AllocTraits<RealAlloc>::allocate(alloc_, new_capacity);
+
+            if (buffer_ != nullptr)
+            {
+                if constexpr (std::is_trivially_copyable_v<T>)
+                {
+                    const auto until_wrap = std::min(size_, capacity_ - head_);
+
+                    std::memcpy(buffer, buffer_ + head_, until_wrap * sizeof(T));
+                    std::memcpy(buffer + until_wrap, buffer_, (size_ - until_wrap) * sizeof(T));
+                }
+                else
+                {
+                    for (auto i = size_type{0}; i < size_; ++i)
+                    {
+                        AllocTraits<RealAlloc>::construct(alloc_, buffer + i, std::move(buffer_[slot(i)]));
+                        AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + slot(i));
+                    }
+                }
+
+                AllocTraits<RealAlloc>::deallocate(alloc_, buffer_, capacity_);
+            }
+
+            buffer_ = buffer;
+            capacity_ = new_capacity;
+            head_ = 0;
+        }
+
+        constexpr static size_type initial_capacity = 8;
+
+        [[no_unique_address]] RealAlloc alloc_;
+        T* buffer_ = nullptr;
+        size_type capacity_ = 0;
+        size_type head_ = 0;
+        size_type size_ = 0;
     };
 } // namespace zinc
 
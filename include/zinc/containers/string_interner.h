@@ -0,0 +1,166 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_STRING_INTERNER
+#define ZINC_CONTAINERS_STRING_INTERNER
+
+#include "zinc/containers/hash_map.h"
+#include "zinc/containers/vec.h"
+#include "zinc/types/allocators/arena.h"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+namespace zinc
+{
+    /// Deduplicates strings into stable, cheap 32-bit symbols: every distinct
+    /// string is stored exactly once, interning the same string twice hands
+    /// back the same `Symbol`, and symbol equality is one integer compare
+    /// instead of a byte compare. The usual shape for identifiers in parsers
+    /// and anything else that sees the same few thousand strings millions of
+    /// times.
+    ///
+    /// The string bytes live in one append-only `Arena` owned by the interner,
+    /// so storage is one real allocation per arena chunk rather than one per
+    /// string, and the `string_view`s handed out by `text_of` stay valid for
+    /// the interner's whole lifetime. Nothing is ever un-interned.
+    class StringInterner
+    {
+    public:
+        /// The stable ID of an interned string. A scoped enum rather than a
+        /// bare `uint32_t` so a symbol can't be mixed up with an unrelated
+        /// index, while staying exactly one register wide with built-in `==`
+        enum class Symbol : std::uint32_t
+        {
+        };
+
+        /// Creates an interner whose arena grows `chunk_size` bytes at a time
+        ///
+        /// # Parameters
+        /// - `chunk_size`: The size of each arena chunk, see `Arena`
+        explicit StringInterner(std::size_t chunk_size = Arena::default_chunk_size) noexcept
+            : arena_(chunk_size)
+        {}
+
+        // the table and the index both hold views into `arena_`, and `Arena`
+        // itself is pinned, so the interner is too - they're long-lived
+        // singleton-shaped objects anyway
+        StringInterner(const StringInterner&) = delete;
+
+        StringInterner(StringInterner&&) = delete;
+
+        StringInterner& operator=(const StringInterner&) = delete;
+
+        StringInterner& operator=(StringInterner&&) = delete;
+
+        ~StringInterner() = default;
+
+        /// Interns `text`, copying its bytes into the arena if this is the
+        /// first time the string has been seen. Interning an already-known
+        /// string is one hash lookup and no allocation.
+        ///
+        /// # Parameters
+        /// - `text`: The string to intern. Need not outlive the call
+        ///
+        /// # Returns
+        /// The symbol every past and future intern of `text` maps to
+        [[nodiscard]] Symbol intern(std::string_view text)
+        {
+            if (const auto it = ids_.find(text); it != ids_.end())
+            {
+                return it->second;
+            }
+
+            assert("a u32 symbol space fits 4 billion strings, and yet" && strings_.size() < UINT32_MAX);
+
+            const auto symbol = Symbol{static_cast<std::uint32_t>(strings_.size())};
+            const auto stable = copy_into_arena(text);
+
+            strings_.push_back(stable);
+            ids_.emplace(stable, symbol);
+
+            return symbol;
+        }
+
+        /// Looks up the symbol for `text` without interning it when it's
+        /// missing. For the "is this keyword / known identifier" probes that
+        /// shouldn't grow the table
+        ///
+        /// # Parameters
+        /// - `text`: The string to look for
+        ///
+        /// # Returns
+        /// The string's symbol, or an empty optional if it was never interned
+        [[nodiscard]] std::optional<Symbol> find(std::string_view text) const noexcept
+        {
+            const auto it = ids_.find(text);
+
+            return (it != ids_.end()) ? std::optional{it->second} : std::nullopt;
+        }
+
+        /// Resolves a symbol back into the interned bytes. The view points
+        /// into the arena and stays valid as long as the interner lives.
+        ///
+        /// # Parameters
+        /// - `symbol`: A symbol previously returned by `intern`
+        ///
+        /// # Returns
+        /// The exact string the symbol was created from
+        [[nodiscard]] std::string_view text_of(Symbol symbol) const noexcept
+        {
+            const auto index = static_cast<std::uint32_t>(symbol);
+
+            assert("resolving a symbol from a different interner?" && index < strings_.size());
+
+            return strings_[index];
+        }
+
+        /// Gets the number of distinct strings interned so far
+        [[nodiscard]] std::size_t size() const noexcept { return strings_.size(); }
+
+        /// Checks whether nothing has been interned yet
+        [[nodiscard]] bool empty() const noexcept { return strings_.empty(); }
+
+        /// Gets the total chunk space the arena has grown to, for the people
+        /// sizing `chunk_size` to their workload
+        [[nodiscard]] std::size_t arena_capacity() const noexcept { return arena_.capacity(); }
+
+    private:
+        [[nodiscard]] std::string_view copy_into_arena(std::string_view text)
+        {
+            if (text.empty())
+            {
+                return {};
+            }
+
+            auto* bytes = static_cast<char*>(arena_.allocate(text.size(), 1));
+
+            std::memcpy(bytes, text.data(), text.size());
+
+            return std::string_view{bytes, text.size()};
+        }
+
+        Arena arena_;
+        HashMap<std::string_view, Symbol> ids_;
+        Vec<std::string_view> strings_;
+    };
+} // namespace zinc
+
+#endif
@@ -0,0 +1,65 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_TABLE_POLICY
+#define ZINC_CONTAINERS_TABLE_POLICY
+
+#include <bit>
+#include <cstddef>
+
+namespace zinc
+{
+    /// Compile-time tuning knobs for the hash tables, passed as a template
+    /// parameter so the probe and rehash code specializes against constants
+    /// instead of reading runtime configuration. The defaults are the values
+    /// every table shipped with before this existed.
+    ///
+    /// - The max load factor is the ratio `LoadNumerator / LoadDenominator`.
+    ///   Read-mostly lookup tables want it low (say 1/2) for shorter probes,
+    ///   memory-bound caches want it high (9/10) to waste fewer slots. It must
+    ///   be below 1: probes stop at empty slots, so some have to exist.
+    /// - `GrowthFactor` multiplies the capacity on overflow. Capacities are
+    ///   committed to powers of two (see `normalize_capacity`), so growth has
+    ///   to be one too - 4 trades memory slack for fewer rehashes.
+    /// - `MinCapacity` is the first real allocation's bucket count, for
+    ///   tables whose rough final size is known up front and shouldn't climb
+    ///   the early rehash ladder to get there.
+    template <std::size_t LoadNumerator = 72,
+        std::size_t LoadDenominator = 100,
+        std::size_t GrowthFactor = 2,
+        std::size_t MinCapacity = 32>
+    struct TablePolicy
+    {
+        static_assert(LoadNumerator > 0 && LoadNumerator < LoadDenominator,
+            "max load factor must be in (0, 1): probing relies on empty slots existing");
+        static_assert(GrowthFactor >= 2 && std::has_single_bit(GrowthFactor),
+            "growth must be a power of two of at least 2, capacities are always powers of two");
+        static_assert(MinCapacity > 0, "tables can't start empty-forever");
+
+        constexpr static float max_load_factor = static_cast<float>(LoadNumerator) / static_cast<float>(LoadDenominator);
+
+        constexpr static std::size_t growth_factor = GrowthFactor;
+
+        constexpr static std::size_t min_capacity = MinCapacity;
+    };
+
+    /// The policy every table uses unless told otherwise
+    using DefaultTablePolicy = TablePolicy<>;
+} // namespace zinc
+
+#endif
@@ -0,0 +1,462 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_CONTAINERS_VEC
+#define ZINC_CONTAINERS_VEC
+
+#include "zinc/containers/detail/small_adapter.h"
+#include "zinc/types/allocators.h"
+#include "zinc/types/pointers.h"
+#include "zinc/util/uninitialized.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace zinc
+{
+    /// A lean `std::vector` equivalent whose main reason for existing is the
+    /// small-buffer protocol: `SmallVec<T, N>` keeps its first `N` elements in
+    /// a buffer embedded in the object itself, paying the allocator nothing
+    /// until it outgrows them. Used standalone it's an ordinary grow-at-the-back
+    /// contiguous array.
+    template <typename T, Allocator<T> Alloc = std::allocator<T>> class Vec
+    {
+        using RealAlloc = AllocRebind<Alloc, T>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using iterator = value_type*;
+        using const_iterator = const value_type*;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        Vec() = default;
+
+        /// The small-buffer protocol, see `detail::SmallAdapter`: the adapter
+        /// embeds `n` slots of storage in itself, and elements live there until
+        /// they outgrow it. That storage belongs to the adapter and can never
+        /// change owners, which `swap` and the growth path have to respect.
+        ///
+        /// # Parameters
+        /// - `buffer`: The adapter's inline storage
+        /// - `n`: How many elements `buffer` can hold
+        Vec(detail::SmallAdapterPlaceholder, AlignedStorageFor<T>* buffer, size_type n) noexcept
+            : buffer_(pointer_cast<T*>(buffer))
+            , capacity_(n)
+            , small_buffer_(pointer_cast<T*>(buffer))
+            , small_slots_(n)
+        {}
+
+        /// Part of the small-buffer protocol: a vector needs exactly one slot
+        /// of inline storage per element, unlike the hash tables
+        ///
+        /// # Parameters
+        /// - `n`: The number of elements the inline buffer should hold
+        [[nodiscard]] constexpr static size_type small_buffer_slots(size_type n) noexcept { return n; }
+
+        /// Creates a vec holding `count` default-constructed elements
+        ///
+        /// # Parameters
+        /// - `count`: The number of elements to construct
+        explicit Vec(size_type count, allocator_type alloc = {})
+            : alloc_(alloc)
+        {
+            reserve(count);
+
+            for (auto i = size_type{0}; i < count; ++i)
+            {
+                emplace_back();
+            }
+        }
+
+        /// Creates a vec holding `count` copies of `value`
+        ///
+        /// # Parameters
+        /// - `count`: The number of copies to insert
+        /// - `value`: The value to copy
+        Vec(size_type count, const T& value, allocator_type alloc = {})
+            : alloc_(alloc)
+        {
+            reserve(count);
+
+            for (auto i = size_type{0}; i < count; ++i)
+            {
+                push_back(value);
+            }
+        }
+
+        /// Creates a vec from the elements in `(first, last]`
+        ///
+        /// # Parameters
+        /// - `first`: A starting iterator
+        /// - `last`: The end iterator to insert up to
+        Vec(std::input_iterator auto first, std::input_iterator auto last, allocator_type alloc = {}) //
+            requires std::constructible_from<T, decltype(*first)>
+            : alloc_(alloc)
+        {
+            if constexpr (std::forward_iterator<decltype(first)>)
+            {
+                reserve(static_cast<size_type>(std::distance(first, last)));
+            }
+
+            for (auto it = first; it != last; ++it)
+            {
+                emplace_back(*it);
+            }
+        }
+
+        /// Creates a vec from an initializer list, preserving order
+        ///
+        /// # Parameters
+        /// - `init_list`: The list of elements to copy in
+        Vec(std::initializer_list<T> init_list, allocator_type alloc = {})
+            : Vec(init_list.begin(), init_list.end(), alloc)
+        {}
+
+        Vec(const Vec& other)
+            : alloc_(AllocTraits<RealAlloc>::select_on_container_copy_construction(other.alloc_))
+        {
+            reserve(other.size());
+
+            for (const auto& value : other)
+            {
+                push_back(value);
+            }
+        }
+
+        Vec(Vec&& other) noexcept
+            : Vec()
+        {
+            swap(*this, other);
+        }
+
+        Vec& operator=(Vec other)
+        {
+            swap(*this, other);
+
+            return *this;
+        }
+
+        ~Vec()
+        {
+            clear();
+            release_storage();
+        }
+
+        /// Returns the allocator in use by the container
+        [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
+        /// Gets the element at `index`, throwing `std::out_of_range` when
+        /// `index >= size()`
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] reference at(size_type index)
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("Vec: index was out of range");
+            }
+
+            return (*this)[index];
+        }
+
+        /// Gets the element at `index`, throwing `std::out_of_range` when
+        /// `index >= size()`
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] const_reference at(size_type index) const
+        {
+            if (index >= size())
+            {
+                throw std::out_of_range("Vec: index was out of range");
+            }
+
+            return (*this)[index];
+        }
+
+        /// Gets the element at `index` with no bounds checking
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] reference operator[](size_type index) noexcept
+        {
+            assert("index is in bounds" && index < size());
+
+            return buffer_[index];
+        }
+
+        /// Gets the element at `index` with no bounds checking
+        ///
+        /// # Parameters
+        /// - `index`: The index to look up, `0` being the front
+        [[nodiscard]] const_reference operator[](size_type index) const noexcept
+        {
+            assert("index is in bounds" && index < size());
+
+            return buffer_[index];
+        }
+
+        /// Gets the first element in the vec
+        [[nodiscard]] reference front() noexcept { return (*this)[0]; }
+
+        /// Gets the first element in the vec
+        [[nodiscard]] const_reference front() const noexcept { return (*this)[0]; }
+
+        /// Gets the last element in the vec
+        [[nodiscard]] reference back() noexcept { return (*this)[size() - 1]; }
+
+        /// Gets the last element in the vec
+        [[nodiscard]] const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+        /// Gets a pointer to the (contiguous) elements
+        [[nodiscard]] pointer data() noexcept { return buffer_; }
+
+        /// Gets a pointer to the (contiguous) elements
+        [[nodiscard]] const_pointer data() const noexcept { return buffer_; }
+
+        /// Part of the small-buffer protocol: exposes the current storage so
+        /// `SmallAdapter::using_small` can tell whether the elements still
+        /// live in the inline buffer
+        [[nodiscard]] const void* raw_storage() const noexcept { return buffer_; }
+
+        /// Gets an iterator to the first element
+        [[nodiscard]] iterator begin() noexcept { return buffer_; }
+
+        /// Gets a past-the-end iterator
+        [[nodiscard]] iterator end() noexcept { return buffer_ + size(); }
+
+        /// Gets a constant iterator to the first element
+        [[nodiscard]] const_iterator begin() const noexcept { return buffer_; }
+
+        /// Gets a constant past-the-end iterator
+        [[nodiscard]] const_iterator end() const noexcept { return buffer_ + size(); }
+
+        /// Gets a constant iterator to the first element
+        [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+
+        /// Gets a constant past-the-end iterator
+        [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+        /// Gets a reverse iterator to the last element
+        [[nodiscard]] reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+        /// Gets a reverse past-the-end iterator
+        [[nodiscard]] reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+        /// Gets a constant reverse iterator to the last element
+        [[nodiscard]] const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+        /// Gets a constant reverse past-the-end iterator
+        [[nodiscard]] const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+        /// Checks if the vec is completely empty
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /// Gets the number of elements currently in the vec
+        [[nodiscard]] size_type size() const noexcept { return size_; }
+
+        /// Gets the number of elements the vec can hold before re-allocating
+        [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+        /// Ensures the vec can hold at least `count` elements without
+        /// re-allocating
+        ///
+        /// # Parameters
+        /// - `count`: The number of elements to make room for
+        void reserve(size_type count)
+        {
+            if (count > capacity_)
+            {
+                relocate(count);
+            }
+        }
+
+        /// Destroys every element, leaving capacity untouched
+        void clear()
+        {
+            std::destroy(begin(), end());
+            size_ = 0;
+        }
+
+        /// Copies `value` onto the back of the vec
+        ///
+        /// # Parameters
+        /// - `value`: The value to copy
+        void push_back(const T& value) { emplace_back(value); }
+
+        /// Moves `value` onto the back of the vec
+        ///
+        /// # Parameters
+        /// - `value`: The value to move
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        /// Constructs a value in-place on the back of the vec
+        ///
+        /// # Parameters
+        /// - `args`: The arguments to construct the value from
+        ///
+        /// # Returns
+        /// A reference to the new element
+        reference emplace_back(auto&&... args) requires std::constructible_from<T, decltype(args)...>
+        {
+            if (size_ == capacity_)
+            {
+                relocate(std::max(capacity_ * 2, minimum_capacity));
+            }
+
+            AllocTraits<RealAlloc>::construct(alloc_, buffer_ + size_, std::forward<decltype(args)>(args)...);
+
+            return buffer_[size_++];
+        }
+
+        /// Removes the last element of the vec
+        void pop_back() noexcept
+        {
+            assert("vec is not empty" && !empty());
+
+            AllocTraits<RealAlloc>::destroy(alloc_, buffer_ + (--size_));
+        }
+
+        /// Grows or shrinks the vec to hold exactly `count` elements, default
+        /// constructing any new ones
+        ///
+        /// # Parameters
+        /// - `count`: The new size of the vec
+        void resize(size_type count)
+        {
+            while (size() > count)
+            {
+                pop_back();
+            }
+
+            reserve(count);
+
+            while (size() < count)
+            {
+                emplace_back();
+            }
+        }
+
+        /// Checks if two vecs hold equal elements in the same order
+        [[nodiscard]] bool operator==(const Vec& other) const
+        {
+            return std::equal(begin(), end(), other.begin(), other.end());
+        }
+
+        /// Swaps two vecs, ADL-compatible and self-swap safe
+        ///
+        /// # Parameters
+        /// - `lhs`: The first vec
+        /// - `rhs`: The vec to swap with `lhs`
+        friend void swap(Vec& lhs, Vec& rhs) noexcept
+        {
+            using std::swap;
+
+            // inline storage is embedded in an adapter and cannot change
+            // owners, spill it into a real allocation first. If allocating
+            // here throws, `noexcept` terminates - the usual trade
+            // small-buffer containers make for cheap swaps elsewhere
+            lhs.spill_inline_buffer();
+            rhs.spill_inline_buffer();
+
+            if constexpr (AllocTraits<RealAlloc>::propagate_on_container_swap::value)
+            {
+                swap(lhs.alloc_, rhs.alloc_);
+            }
+
+            swap(lhs.buffer_, rhs.buffer_);
+            swap(lhs.capacity_, rhs.capacity_);
+            swap(lhs.size_, rhs.size_);
+        }
+
+    private:
+        constexpr static size_type minimum_capacity = 8;
+
+        // checks if the elements currently live in a `SmallAdapter`'s buffer
+        [[nodiscard]] bool is_inline() const noexcept { return buffer_ != nullptr && buffer_ == small_buffer_; }
+
+        // moves inline elements into a real allocation, leaving the inline
+        // buffer dead. The one case where storage has to move without the
+        // capacity growing: handing the elements to another object
+        void spill_inline_buffer()
+        {
+            if (is_inline())
+            {
+                relocate(capacity_);
+            }
+        }
+
+        // gives the current allocation back to the allocator, unless the
+        // elements live in an adapter's inline buffer, which is not ours to free
+        void release_storage()
+        {
+            if (buffer_ != nullptr && !is_inline())
+            {
+                AllocTraits<RealAlloc>::deallocate(alloc_, buffer_, capacity_);
+            }
+        }
+
+        // moves every element into a fresh allocation of (at least)
+        // `new_capacity` elements and releases the old storage
+        void relocate(size_type new_capacity)
+        {
+            new_capacity = std::max(new_capacity, size_);
+
+            auto* fresh = AllocTraits<RealAlloc>::allocate(alloc_, new_capacity);
+
+            uninitialized_relocate_n(alloc_, buffer_, size_, fresh);
+            release_storage();
+
+            buffer_ = fresh;
+            capacity_ = new_capacity;
+        }
+
+        [[no_unique_address]] RealAlloc alloc_;
+        T* buffer_ = nullptr;
+        size_type capacity_ = 0;
+        size_type size_ = 0;
+        // the small-buffer protocol: when a `SmallAdapter` embeds our storage,
+        // these describe it. They belong to *this object* rather than to the
+        // elements, so swap/copy/move never transfer them
+        T* small_buffer_ = nullptr;
+        size_type small_slots_ = 0;
+    };
+
+    /// `Vec` whose first `N` elements live in a buffer inside the vec object
+    /// itself - zero allocator traffic until the elements outgrow it
+    template <typename T, std::size_t N, Allocator<T> Alloc = std::allocator<T>>
+    using SmallVec = detail::SmallAdapter<Vec<T, Alloc>, N>;
+} // namespace zinc
+
+#endif
@@ -0,0 +1,749 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_IO_ASYNC_FILE
+#define ZINC_IO_ASYNC_FILE
+
+#include "zinc/io/file.h"
+#include "zinc/parallel/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#endif
+
+namespace zinc
+{
+    /// A lazy coroutine: calling a `Task`-returning coroutine builds the
+    /// frame but runs nothing until the task is `co_await`ed (or driven from
+    /// synchronous code with `block_on`). Awaiting hands control straight to
+    /// the task and gets it back when the task finishes, with the result (or
+    /// the exception it ended on) delivered through `co_await`.
+    ///
+    /// Tasks are one-shot and move-only: awaiting consumes the result, and
+    /// the frame dies with the `Task` object.
+    template <typename T> class [[nodiscard]] Task
+    {
+    public:
+        struct promise_type
+        {
+            // at final suspend, control transfers straight to whoever was
+            // awaiting us (or the noop coroutine, if nobody ever did)
+            struct FinalAwaiter
+            {
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                {
+                    return handle.promise().continuation;
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            template <typename U> void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+            void unhandled_exception() { error = std::current_exception(); }
+
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+            std::optional<T> value;
+            std::exception_ptr error;
+        };
+
+        Task(const Task&) = delete;
+
+        Task(Task&& other) noexcept
+            : handle_(std::exchange(other.handle_, {}))
+        {}
+
+        Task& operator=(const Task&) = delete;
+
+        Task& operator=(Task&& other) noexcept
+        {
+            auto moved = std::move(other);
+
+            std::swap(handle_, moved.handle_);
+
+            return *this;
+        }
+
+        ~Task()
+        {
+            if (handle_)
+            {
+                handle_.destroy();
+            }
+        }
+
+        /// Awaits the task: starts it, suspends the awaiter until it
+        /// finishes, and yields its result (rethrowing if it threw)
+        [[nodiscard]] auto operator co_await() noexcept
+        {
+            struct Awaiter
+            {
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) const noexcept
+                {
+                    handle.promise().continuation = continuation;
+
+                    return handle;
+                }
+
+                [[nodiscard]] T await_resume() const
+                {
+                    auto& promise = handle.promise();
+
+                    if (promise.error)
+                    {
+                        std::rethrow_exception(promise.error);
+                    }
+
+                    return std::move(*promise.value);
+                }
+
+                std::coroutine_handle<promise_type> handle;
+            };
+
+            return Awaiter{handle_};
+        }
+
+    private:
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+            : handle_(handle)
+        {}
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    namespace detail
+    {
+        // the root of a `block_on` call: instead of resuming a continuation
+        // at final suspend, it releases the semaphore the blocked thread is
+        // parked on. it stays suspended there, so the frame (and the result
+        // inside it) outlives the signal.
+        template <typename T> class BlockingTask
+        {
+        public:
+            struct promise_type
+            {
+                struct FinalAwaiter
+                {
+                    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                    void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                    {
+                        handle.promise().done->release();
+                    }
+
+                    void await_resume() const noexcept {}
+                };
+
+                BlockingTask get_return_object()
+                {
+                    return BlockingTask(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+
+                [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+                [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+
+                void return_value(T result) { value.emplace(std::move(result)); }
+
+                void unhandled_exception() { error = std::current_exception(); }
+
+                std::binary_semaphore* done = nullptr;
+                std::optional<T> value;
+                std::exception_ptr error;
+            };
+
+            BlockingTask(const BlockingTask&) = delete;
+
+            BlockingTask(BlockingTask&& other) noexcept
+                : handle_(std::exchange(other.handle_, {}))
+            {}
+
+            BlockingTask& operator=(const BlockingTask&) = delete;
+
+            BlockingTask& operator=(BlockingTask&&) = delete;
+
+            ~BlockingTask()
+            {
+                if (handle_)
+                {
+                    handle_.destroy();
+                }
+            }
+
+            [[nodiscard]] T run()
+            {
+                auto done = std::binary_semaphore(0);
+                auto& promise = handle_.promise();
+
+                promise.done = &done;
+                handle_.resume();
+                done.acquire();
+
+                if (promise.error)
+                {
+                    std::rethrow_exception(promise.error);
+                }
+
+                return std::move(*promise.value);
+            }
+
+        private:
+            explicit BlockingTask(std::coroutine_handle<promise_type> handle) noexcept
+                : handle_(handle)
+            {}
+
+            std::coroutine_handle<promise_type> handle_;
+        };
+
+        template <typename T> BlockingTask<T> blocking_wrapper(Task<T> task) { co_return co_await task; }
+
+        // one in-flight operation: heap-allocated so the completion side can
+        // find it again through a ring's 64-bit user_data slot
+        struct PendingIoOp
+        {
+            std::function<void(std::int32_t)> on_complete;
+        };
+
+        // awaits one raw I/O operation: suspends, submits through `submit`
+        // with a callback that resumes the coroutine, and resumes with the
+        // operation's result (a count or fd if non-negative, -errno if not)
+        template <typename SubmitFn> class IoAwaiter
+        {
+        public:
+            explicit IoAwaiter(SubmitFn submit)
+                : submit_(std::move(submit))
+            {}
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                submit_([this, handle](std::int32_t result) {
+                    result_ = result;
+                    handle.resume();
+                });
+            }
+
+            [[nodiscard]] std::int32_t await_resume() const noexcept { return result_; }
+
+        private:
+            SubmitFn submit_;
+            std::int32_t result_ = 0;
+        };
+    } // namespace detail
+
+    /// Runs a task to completion from non-coroutine code, blocking the
+    /// calling thread until it finishes
+    ///
+    /// # Parameters
+    /// - `task`: The task to run
+    ///
+    /// # Returns
+    /// Whatever the task returned (rethrowing whatever it threw)
+    template <typename T> [[nodiscard]] T block_on(Task<T> task)
+    {
+        auto blocking = detail::blocking_wrapper(std::move(task));
+
+        return blocking.run();
+    }
+
+    class AsyncFile;
+
+    /// The engine behind async file I/O: owns the io_uring instance that
+    /// every `co_await` on a file funnels into. Thousands of opens and reads
+    /// can be in flight on one ring at once - that batching, not any single
+    /// operation getting faster, is where the throughput comes from when
+    /// threads blocked in `open`/`read` are the bottleneck.
+    ///
+    /// Off Linux (or on kernels/sandboxes where the ring can't be created,
+    /// checked at runtime), operations fall back to blocking syscalls on a
+    /// `ThreadPool`, so callers are portable and just scale less.
+    ///
+    /// Operations complete on the engine's own thread(s); a coroutine that
+    /// was awaiting one resumes there. Everything awaited on an `AsyncIo`
+    /// must finish before it's destroyed - `block_on` at the root takes care
+    /// of that naturally.
+    class AsyncIo
+    {
+    public:
+        /// Creates an engine whose ring holds up to `entries` in-flight
+        /// submissions (rounded to what the kernel grants)
+        ///
+        /// # Parameters
+        /// - `entries`: How many submissions the ring should hold
+        explicit AsyncIo(unsigned entries = 256)
+        {
+#ifdef __linux__
+            if (init_uring(entries))
+            {
+                reaper_ = std::thread([this] {
+                    uring_reap_loop();
+                });
+
+                return;
+            }
+#endif
+
+            pool_ = std::make_unique<ThreadPool>();
+        }
+
+        AsyncIo(const AsyncIo&) = delete;
+
+        AsyncIo(AsyncIo&&) = delete;
+
+        AsyncIo& operator=(const AsyncIo&) = delete;
+
+        AsyncIo& operator=(AsyncIo&&) = delete;
+
+        ~AsyncIo()
+        {
+#ifdef __linux__
+            if (using_uring())
+            {
+                // a NOP with null user_data is the reaper's stop signal
+                auto sqe = io_uring_sqe{};
+
+                sqe.opcode = IORING_OP_NOP;
+                uring_submit(sqe);
+                reaper_.join();
+                teardown_uring();
+            }
+#endif
+        }
+
+        /// Asynchronously opens a file for reading
+        ///
+        /// # Parameters
+        /// - `path`: The path of the file to open
+        ///
+        /// # Returns
+        /// A task yielding the opened file, or throwing `BadFileOpen`
+        [[nodiscard]] Task<AsyncFile> open(std::filesystem::path path);
+
+        /// Checks whether operations actually go through an io_uring, as
+        /// opposed to the blocking-syscall fallback pool
+        [[nodiscard]] bool using_uring() const noexcept
+        {
+#ifdef __linux__
+            return ring_fd_ >= 0;
+#else
+            return false;
+#endif
+        }
+
+    private:
+        friend class AsyncFile;
+
+        using Callback = std::function<void(std::int32_t)>;
+
+        // `path` and `buffer` must stay alive until the callback runs; the
+        // awaiting coroutine's frame guarantees that for the awaitable users
+        void submit_open(const char* path, Callback on_complete)
+        {
+#ifdef __linux__
+            if (using_uring())
+            {
+                auto sqe = io_uring_sqe{};
+
+                sqe.opcode = IORING_OP_OPENAT;
+                sqe.fd = AT_FDCWD;
+                sqe.addr = reinterpret_cast<std::uint64_t>(path);
+                sqe.open_flags = O_RDONLY;
+                sqe.user_data = reinterpret_cast<std::uint64_t>(new detail::PendingIoOp{std::move(on_complete)});
+                uring_submit(sqe);
+
+                return;
+            }
+#endif
+
+            pool_->submit([path, on_complete = std::move(on_complete)] {
+#ifdef _WIN32
+                auto fd = -1;
+
+                (void)_sopen_s(&fd, path, _O_RDONLY | _O_BINARY, _SH_DENYNO, 0);
+                on_complete(fd >= 0 ? fd : -EIO);
+#else
+                const auto fd = ::open(path, O_RDONLY);
+
+                on_complete(fd >= 0 ? fd : -errno);
+#endif
+            });
+        }
+
+        void submit_read(int fd, void* buffer, std::size_t length, std::uint64_t offset, Callback on_complete)
+        {
+#ifdef __linux__
+            if (using_uring())
+            {
+                auto sqe = io_uring_sqe{};
+
+                sqe.opcode = IORING_OP_READ;
+                sqe.fd = fd;
+                sqe.addr = reinterpret_cast<std::uint64_t>(buffer);
+                sqe.len = static_cast<unsigned>(length);
+                sqe.off = offset;
+                sqe.user_data = reinterpret_cast<std::uint64_t>(new detail::PendingIoOp{std::move(on_complete)});
+                uring_submit(sqe);
+
+                return;
+            }
+#endif
+
+            pool_->submit([fd, buffer, length, offset, on_complete = std::move(on_complete)] {
+#ifdef _WIN32
+                (void)_lseeki64(fd, static_cast<long long>(offset), SEEK_SET);
+
+                const auto count = _read(fd, buffer, static_cast<unsigned>(length));
+#else
+                const auto count = ::pread(fd, buffer, length, static_cast<off_t>(offset));
+#endif
+
+                on_complete(count >= 0 ? static_cast<std::int32_t>(count) : -errno);
+            });
+        }
+
+#ifdef __linux__
+        [[nodiscard]] bool init_uring(unsigned entries)
+        {
+            auto params = io_uring_params{};
+
+            ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+
+            if (ring_fd_ < 0)
+            {
+                return false;
+            }
+
+            sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+            // newer kernels hand out one mapping for both rings
+            const auto single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+            if (single_mmap)
+            {
+                sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+            }
+
+            sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                IORING_OFF_SQ_RING);
+            cq_ring_ = single_mmap ? sq_ring_
+                                   : ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                       ring_fd_, IORING_OFF_CQ_RING);
+            sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+            sqes_ = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                IORING_OFF_SQES);
+
+            if (sq_ring_ == MAP_FAILED || cq_ring_ == MAP_FAILED || sqes_ == MAP_FAILED)
+            {
+                teardown_uring();
+
+                return false;
+            }
+
+            const auto sq = static_cast<char*>(sq_ring_);
+            const auto cq = static_cast<char*>(cq_ring_);
+
+            sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+            sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+            sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+            cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+            cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+            cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+            cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+            return true;
+        }
+
+        void teardown_uring()
+        {
+            if (sq_ring_ != MAP_FAILED)
+            {
+                ::munmap(sq_ring_, sq_ring_size_);
+            }
+
+            if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_)
+            {
+                ::munmap(cq_ring_, cq_ring_size_);
+            }
+
+            if (sqes_ != MAP_FAILED)
+            {
+                ::munmap(sqes_, sqes_size_);
+            }
+
+            ::close(ring_fd_);
+
+            ring_fd_ = -1;
+            sq_ring_ = cq_ring_ = sqes_ = MAP_FAILED;
+        }
+
+        void uring_submit(const io_uring_sqe& sqe)
+        {
+            auto lock = std::unique_lock(submit_mutex_);
+
+            // every submission is followed by an enter, which (without
+            // SQPOLL) consumes the whole queue synchronously - so the slot
+            // at the tail is always free here
+            const auto tail = std::atomic_ref(*sq_tail_).load(std::memory_order_relaxed);
+            const auto index = tail & *sq_mask_;
+
+            reinterpret_cast<io_uring_sqe*>(sqes_)[index] = sqe;
+            sq_array_[index] = index;
+            std::atomic_ref(*sq_tail_).store(tail + 1, std::memory_order_release);
+
+            (void)::syscall(__NR_io_uring_enter, ring_fd_, 1, 0, 0, nullptr, 0);
+        }
+
+        void uring_reap_loop()
+        {
+            auto completed = std::vector<std::pair<detail::PendingIoOp*, std::int32_t>>();
+
+            for (;;)
+            {
+                (void)::syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+                // a completion implies its submission, but the kernel's part
+                // of that ordering is invisible to the memory model (and to
+                // tsan) - pairing with the submitter's release of the SQ tail
+                // is what formally publishes the op and the frame awaiting it
+                (void)std::atomic_ref(*sq_tail_).load(std::memory_order_acquire);
+
+                auto head = std::atomic_ref(*cq_head_).load(std::memory_order_relaxed);
+                const auto tail = std::atomic_ref(*cq_tail_).load(std::memory_order_acquire);
+                auto saw_stop = false;
+
+                while (head != tail)
+                {
+                    const auto& cqe = cqes_[head & *cq_mask_];
+
+                    if (cqe.user_data == 0)
+                    {
+                        saw_stop = true;
+                    }
+                    else
+                    {
+                        completed.emplace_back(reinterpret_cast<detail::PendingIoOp*>(cqe.user_data), cqe.res);
+                    }
+
+                    ++head;
+                }
+
+                // free the ring slots before running callbacks, since a
+                // resumed coroutine usually submits its next operation
+                std::atomic_ref(*cq_head_).store(head, std::memory_order_release);
+
+                for (auto& [op, result] : completed)
+                {
+                    op->on_complete(result);
+                    delete op;
+                }
+
+                completed.clear();
+
+                if (saw_stop)
+                {
+                    return;
+                }
+            }
+        }
+
+        int ring_fd_ = -1;
+        void* sq_ring_ = MAP_FAILED;
+        void* cq_ring_ = MAP_FAILED;
+        void* sqes_ = MAP_FAILED;
+        std::size_t sq_ring_size_ = 0;
+        std::size_t cq_ring_size_ = 0;
+        std::size_t sqes_size_ = 0;
+        unsigned* sq_tail_ = nullptr;
+        unsigned* sq_mask_ = nullptr;
+        unsigned* sq_array_ = nullptr;
+        unsigned* cq_head_ = nullptr;
+        unsigned* cq_tail_ = nullptr;
+        unsigned* cq_mask_ = nullptr;
+        io_uring_cqe* cqes_ = nullptr;
+        std::mutex submit_mutex_;
+        std::thread reaper_;
+#endif
+
+        std::unique_ptr<ThreadPool> pool_;
+    };
+
+    /// A file opened through an `AsyncIo`, read with `co_await` instead of
+    /// blocking. Move-only; the descriptor closes with the object. The file
+    /// must not outlive the engine that opened it, and one file should be
+    /// awaited from one coroutine at a time.
+    class AsyncFile
+    {
+    public:
+        AsyncFile(const AsyncFile&) = delete;
+
+        AsyncFile(AsyncFile&& other) noexcept
+            : io_(other.io_)
+            , fd_(std::exchange(other.fd_, -1))
+            , path_(std::move(other.path_))
+        {}
+
+        AsyncFile& operator=(const AsyncFile&) = delete;
+
+        AsyncFile& operator=(AsyncFile&& other) noexcept
+        {
+            auto moved = std::move(other);
+
+            std::swap(io_, moved.io_);
+            std::swap(fd_, moved.fd_);
+            std::swap(path_, moved.path_);
+
+            return *this;
+        }
+
+        ~AsyncFile()
+        {
+            if (fd_ >= 0)
+            {
+#ifdef _WIN32
+                (void)_close(fd_);
+#else
+                (void)::close(fd_);
+#endif
+            }
+        }
+
+        /// Asynchronously reads the whole file into a string
+        ///
+        /// # Returns
+        /// A task yielding the file's contents, or throwing
+        /// `BadFileOperation` if a read fails
+        [[nodiscard]] Task<std::string> read_all()
+        {
+            auto contents = std::string();
+            auto chunk = std::string(chunk_size, '\0');
+            auto offset = std::uint64_t{0};
+
+            for (;;)
+            {
+                const auto count = co_await detail::IoAwaiter([this, &chunk, offset](AsyncIo::Callback on_complete) {
+                    io_->submit_read(fd_, chunk.data(), chunk.size(), offset, std::move(on_complete));
+                });
+
+                if (count < 0)
+                {
+                    throw BadFileOperation(detail::FileUnreadablePlaceholder{}, path_);
+                }
+
+                if (count == 0)
+                {
+                    break;
+                }
+
+                contents.append(chunk.data(), static_cast<std::size_t>(count));
+                offset += static_cast<std::uint64_t>(count);
+            }
+
+            co_return std::move(contents);
+        }
+
+        /// Gets the path the file was opened from
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+    private:
+        friend class AsyncIo;
+
+        constexpr static std::size_t chunk_size = 64 * 1024;
+
+        explicit AsyncFile(AsyncIo& io, int fd, std::filesystem::path path) noexcept
+            : io_(&io)
+            , fd_(fd)
+            , path_(std::move(path))
+        {}
+
+        AsyncIo* io_;
+        int fd_;
+        std::filesystem::path path_;
+    };
+
+    inline Task<AsyncFile> AsyncIo::open(std::filesystem::path path)
+    {
+        if (std::filesystem::is_directory(path))
+        {
+            throw BadFileOpen(detail::CantOpenDirPlaceholder{}, path);
+        }
+
+        const auto native = path.string();
+        const auto fd = co_await detail::IoAwaiter([this, &native](Callback on_complete) {
+            submit_open(native.c_str(), std::move(on_complete));
+        });
+
+        if (fd < 0)
+        {
+            throw BadFileOpen(detail::AccessDeniedPlaceholder{}, path);
+        }
+
+        co_return AsyncFile(*this, fd, std::move(path));
+    }
+
+    /// Asynchronously opens a file for reading, the `co_await`able sibling
+    /// of the `BasicFile` overloads
+    ///
+    /// # Parameters
+    /// - `io`: The engine the file's operations go through
+    /// - `path`: The path of the file to open
+    ///
+    /// # Returns
+    /// A task yielding the opened file, or throwing `BadFileOpen`
+    [[nodiscard]] inline Task<AsyncFile> open_file(AsyncIo& io, std::filesystem::path path)
+    {
+        return io.open(std::move(path));
+    }
+} // namespace zinc
+
+#endif
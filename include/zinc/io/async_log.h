@@ -0,0 +1,268 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_IO_ASYNC_LOG
+#define ZINC_IO_ASYNC_LOG
+
+#include "zinc/io/console.h"
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace zinc
+{
+    /// An asynchronous logging sink: producers on any number of threads drop
+    /// complete, formatted records into a fixed-size lock-free MPSC ring, and
+    /// one drain thread batches them to the underlying stream. The producer
+    /// side costs one CAS and a memcpy - no mutex, no stream, no syscall -
+    /// which takes logging off the latency path entirely, and because records
+    /// land in the ring whole, output never interleaves mid-line.
+    ///
+    /// The ring is the Vyukov bounded-queue design: every slot carries a
+    /// sequence number that tells producers whether it's free and the consumer
+    /// whether it's full, so the only contended operation is the claim on the
+    /// write cursor. When the ring is full, `try_log` refuses (drop-friendly
+    /// callers) and `log` spins (drop-averse ones).
+    ///
+    /// Records longer than `record_capacity` are truncated; this is a logging
+    /// ring, not a general transport.
+    ///
+    /// All producers must be done logging before the sink is destroyed - the
+    /// destructor drains whatever is left, then stops the drain thread.
+    class AsyncLog
+    {
+    public:
+        /// How many bytes one record slot holds; longer records are truncated
+        constexpr static std::size_t record_capacity = 256;
+
+        /// Creates a sink draining into `out`, with at least `capacity` record
+        /// slots (rounded up to a power of two)
+        ///
+        /// # Parameters
+        /// - `out`: The stream the drain thread batches records into
+        /// - `capacity`: The minimum number of in-flight records the ring holds
+        explicit AsyncLog(std::ostream& out, std::size_t capacity = 1024)
+            : out_(out)
+            , mask_(std::bit_ceil(capacity) - 1)
+            , cells_(std::make_unique<Cell[]>(mask_ + 1))
+        {
+            for (auto i = std::size_t{0}; i <= mask_; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            drain_ = std::thread([this] {
+                drain_loop();
+            });
+        }
+
+        AsyncLog(const AsyncLog&) = delete;
+
+        AsyncLog(AsyncLog&&) = delete;
+
+        AsyncLog& operator=(const AsyncLog&) = delete;
+
+        AsyncLog& operator=(AsyncLog&&) = delete;
+
+        /// Drains every record still in the ring, then stops the drain thread
+        ~AsyncLog()
+        {
+            stop_.store(true, std::memory_order_release);
+            drain_.join();
+        }
+
+        /// Tries to enqueue one record, refusing instead of waiting if the
+        /// ring is full (i.e. the drain thread is more than a whole ring
+        /// behind). One CAS and a memcpy on success.
+        ///
+        /// # Parameters
+        /// - `record`: The formatted record, truncated to `record_capacity`
+        ///
+        /// # Returns
+        /// Whether the record made it into the ring
+        [[nodiscard]] bool try_log(std::string_view record) noexcept
+        {
+            auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+
+                const auto seq = cell->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    // the slot is free: claim it by bumping the write cursor
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // the consumer hasn't released this slot yet: ring is full
+                    return false;
+                }
+                else
+                {
+                    // someone else claimed it between our load and our CAS
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            const auto length = std::min(record.size(), record_capacity);
+
+            std::memcpy(cell->data, record.data(), length);
+            cell->length = length;
+
+            // publishes the record: the consumer's acquire load of `sequence`
+            // sees the bytes written above
+            cell->sequence.store(pos + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /// Enqueues one record, spinning until the ring has room. Use this
+        /// when dropping records is worse than stalling a producer.
+        ///
+        /// # Parameters
+        /// - `record`: The formatted record, truncated to `record_capacity`
+        void log(std::string_view record) noexcept
+        {
+            while (!try_log(record))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        /// The drop-in replacement for `zinc::println` on hot threads: formats
+        /// the arguments into the caller's thread-local print buffer, then
+        /// enqueues the finished line as one record
+        ///
+        /// # Parameters
+        /// - `args`: The objects to print, in order
+        template <typename... Args> requires(Printable<Args> &&...) void println(Args&&... args)
+        {
+            auto& buffer = detail::build_print_buffer(args...);
+
+            buffer.push_back('\n');
+
+            log(buffer);
+        }
+
+        /// `println` with a compile-time format string, same as the free one
+        ///
+        /// # Parameters
+        /// - `args`: The objects to format, one per `{}`, in order
+        template <FixedString Fmt, typename... Args> requires(Printable<Args> &&...) void println(Args&&... args)
+        {
+            auto& buffer = detail::print_buffer();
+
+            buffer.clear();
+            detail::format_into<Fmt>(buffer, args...);
+            buffer.push_back('\n');
+
+            log(buffer);
+        }
+
+    private:
+        // one record slot, padded so two slots never share a cache line and
+        // producer claims don't false-share
+        struct alignas(64) Cell
+        {
+            std::atomic<std::size_t> sequence;
+            std::size_t length;
+            char data[record_capacity]; // NOLINT: the fixed slot is the design
+        };
+
+        // appends one ready record to the batch, if there is one
+        [[nodiscard]] bool drain_one(std::string& batch)
+        {
+            auto& cell = cells_[dequeue_pos_ & mask_];
+
+            if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1)
+            {
+                return false;
+            }
+
+            batch.append(cell.data, cell.length);
+
+            // hands the slot back to producers, one full lap ahead
+            cell.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+            ++dequeue_pos_;
+
+            return true;
+        }
+
+        void drain_loop()
+        {
+            // records are batched here so quiet periods cost one write for
+            // many records instead of one each
+            std::string batch;
+
+            for (;;)
+            {
+                batch.clear();
+
+                while (drain_one(batch) && batch.size() < max_batch_bytes)
+                {
+                }
+
+                if (!batch.empty())
+                {
+                    out_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+
+                    continue;
+                }
+
+                if (stop_.load(std::memory_order_acquire))
+                {
+                    out_.flush();
+
+                    return;
+                }
+
+                // nothing to do: don't spin a core just to wait for logs
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+        // flush at least this often so one giant burst can't balloon the batch
+        constexpr static std::size_t max_batch_bytes = std::size_t{64} * 1024;
+
+        std::ostream& out_;
+        std::size_t mask_;
+        std::unique_ptr<Cell[]> cells_;
+        alignas(64) std::atomic<std::size_t> enqueue_pos_ = 0;
+        alignas(64) std::size_t dequeue_pos_ = 0; // drain thread's alone
+        std::atomic<bool> stop_ = false;
+        std::thread drain_;
+    };
+} // namespace zinc
+
+#endif
@@ -20,25 +20,288 @@
 #define ZINC_IO_PRINT
 
 #include "zinc/io/concepts.h"
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace zinc
 {
+    namespace detail
+    {
+        // one append buffer per thread, re-used across every print call so the
+        // steady state allocates nothing at all
+        [[nodiscard]] inline std::string& print_buffer()
+        {
+            thread_local std::string buffer;
+
+            return buffer;
+        }
+
+        // appends one value's text to the buffer: strings are copied, numbers
+        // go through to_chars, and only types we know nothing about fall back
+        // to their operator<< (with its virtual dispatch, locale and sentry
+        // costs). Output matches what a default-constructed ostream prints.
+        template <Printable T> void append_formatted(std::string& out, const T& value)
+        {
+            using Decayed = std::decay_t<T>;
+
+            if constexpr (std::is_same_v<Decayed, char>)
+            {
+                out.push_back(value);
+            }
+            else if constexpr (std::is_same_v<Decayed, bool>)
+            {
+                // what `<<` prints without `boolalpha`
+                out.push_back(value ? '1' : '0');
+            }
+            else if constexpr (std::is_arithmetic_v<Decayed>)
+            {
+                // large enough for any integer, and any double's shortest form
+                char digits[64]; // NOLINT: to_chars is the entire point
+
+                const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+
+                out.append(digits, result.ptr);
+            }
+            else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+            {
+                out += std::string_view(value);
+            }
+            else
+            {
+                std::ostringstream stream;
+
+                stream << value;
+
+                out += stream.view();
+            }
+        }
+
+        template <typename... Args> [[nodiscard]] std::string& build_print_buffer(const Args&... args)
+        {
+            auto& buffer = print_buffer();
+
+            buffer.clear();
+
+            (append_formatted(buffer, args), ...);
+
+            return buffer;
+        }
+    } // namespace detail
+
+    /// Prints every argument to `out`, back to back, through one `write` call
+    /// instead of one `operator<<` (and its sentry/locale/virtual-dispatch
+    /// toll) per argument
+    ///
+    /// # Parameters
+    /// - `out`: The stream to print to
+    /// - `args`: The objects to print, in order
     template <typename... Args> requires(Printable<Args> &&...) void sprint(std::ostream &out, Args &&...args)
     {
-        (out << ... << args);
+        const auto& buffer = detail::build_print_buffer(args...);
+
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
     }
 
+    /// Prints every argument to stdout, back to back, as one buffered write
+    ///
+    /// # Parameters
+    /// - `args`: The objects to print, in order
     template <typename... Args> requires(Printable<Args> &&...) void print(Args &&...args)
     {
-        return sprint(std::cout, std::forward<Args>(args)...);
+        const auto& buffer = detail::build_print_buffer(args...);
+
+        std::fwrite(buffer.data(), 1, buffer.size(), stdout);
     }
 
+    /// Prints every argument to stdout followed by a newline, as one buffered
+    /// write. The newline rides in the same `write`, it doesn't flush.
+    ///
+    /// # Parameters
+    /// - `args`: The objects to print, in order
     template <typename... Args> requires(Printable<Args> &&...) void println(Args &&...args)
     {
         return print(std::forward<Args>(args)..., '\n');
     }
+
+    /// A string literal usable as a template argument, which is what lets the
+    /// format family take its format string as a template parameter and chew
+    /// through it entirely at compile time
+    template <std::size_t N> struct FixedString
+    {
+        char contents[N] = {}; // NOLINT: the literal it's built from is an array too
+
+        constexpr FixedString(const char (&literal)[N]) noexcept // NOLINT: implicit by design, it mimics a literal
+        {
+            for (auto i = std::size_t{0}; i < N; ++i)
+            {
+                contents[i] = literal[i];
+            }
+        }
+
+        /// Views the string, without the terminating nul
+        [[nodiscard]] constexpr std::string_view view() const noexcept { return {contents, N - 1}; }
+    };
+
+    namespace detail
+    {
+        // one literal run of a format string, between two `{}`s
+        struct FormatSegment
+        {
+            std::size_t offset;
+            std::size_t length;
+        };
+
+        // a hand-rolled find, because `string_view::find` over a template
+        // parameter object's storage isn't a constant expression on every
+        // compiler we support
+        [[nodiscard]] constexpr std::size_t find_placeholder(std::string_view fmt, std::size_t from) noexcept
+        {
+            for (auto i = from; i + 1 < fmt.size(); ++i)
+            {
+                if (fmt[i] == '{' && fmt[i + 1] == '}')
+                {
+                    return i;
+                }
+            }
+
+            return std::string_view::npos;
+        }
+
+        [[nodiscard]] constexpr std::size_t count_placeholders(std::string_view fmt) noexcept
+        {
+            auto count = std::size_t{0};
+
+            for (auto pos = find_placeholder(fmt, 0); pos != std::string_view::npos;
+                 pos = find_placeholder(fmt, pos + 2))
+            {
+                ++count;
+            }
+
+            return count;
+        }
+
+        // slices a format string into the N + 1 literal pieces around its N
+        // placeholders, entirely at compile time
+        template <std::size_t Count>
+        [[nodiscard]] constexpr std::array<FormatSegment, Count + 1> split_format(std::string_view fmt) noexcept
+        {
+            std::array<FormatSegment, Count + 1> segments = {};
+            auto start = std::size_t{0};
+
+            for (auto i = std::size_t{0}; i < Count; ++i)
+            {
+                const auto pos = find_placeholder(fmt, start);
+
+                segments[i] = {start, pos - start};
+                start = pos + 2;
+            }
+
+            segments[Count] = {start, fmt.size() - start};
+
+            return segments;
+        }
+
+        // the fully specialized formatting sequence: alternate copying one
+        // precomputed literal piece and formatting one argument. No scanning,
+        // no type erasure, nothing the optimizer can't see through.
+        template <FixedString Fmt, typename... Args> void format_into(std::string& out, const Args&... args)
+        {
+            constexpr auto fmt = Fmt.view();
+
+            static_assert(count_placeholders(fmt) == sizeof...(Args),
+                "format string must have exactly one {} per argument");
+
+            constexpr auto segments = split_format<sizeof...(Args)>(fmt);
+
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((out.append(fmt.data() + segments[I].offset, segments[I].length), append_formatted(out, args)), ...);
+            }(std::index_sequence_for<Args...>{});
+
+            out.append(fmt.data() + segments.back().offset, segments.back().length);
+        }
+    } // namespace detail
+
+    /// Formats arguments into the `{}` placeholders of a format string that's
+    /// parsed entirely at compile time: the call compiles down to copying the
+    /// literal pieces and `to_chars`-ing the arguments, with no runtime string
+    /// scanning and no type erasure. A placeholder/argument count mismatch is
+    /// a compile error, not an exception.
+    ///
+    /// ```cpp
+    /// auto message = zinc::format<"x = {}, y = {}">(x, y);
+    /// ```
+    ///
+    /// Placeholders are exactly `{}`; any other brace is an ordinary character.
+    ///
+    /// # Parameters
+    /// - `args`: The objects to format, one per `{}`, in order
+    ///
+    /// # Returns
+    /// The formatted string
+    template <FixedString Fmt, typename... Args>
+    requires(Printable<Args> &&...) [[nodiscard]] std::string format(Args&&... args)
+    {
+        std::string out;
+
+        detail::format_into<Fmt>(out, args...);
+
+        return out;
+    }
+
+    /// Prints with a compile-time format string to `out`, as one `write` call
+    ///
+    /// # Parameters
+    /// - `out`: The stream to print to
+    /// - `args`: The objects to format, one per `{}`, in order
+    template <FixedString Fmt, typename... Args>
+    requires(Printable<Args> &&...) void sprint(std::ostream& out, Args&&... args)
+    {
+        auto& buffer = detail::print_buffer();
+
+        buffer.clear();
+        detail::format_into<Fmt>(buffer, args...);
+
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    /// Prints with a compile-time format string to stdout, as one buffered
+    /// write
+    ///
+    /// # Parameters
+    /// - `args`: The objects to format, one per `{}`, in order
+    template <FixedString Fmt, typename... Args> requires(Printable<Args> &&...) void print(Args&&... args)
+    {
+        auto& buffer = detail::print_buffer();
+
+        buffer.clear();
+        detail::format_into<Fmt>(buffer, args...);
+
+        std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+    }
+
+    /// Prints with a compile-time format string to stdout, with a trailing
+    /// newline riding in the same write
+    ///
+    /// # Parameters
+    /// - `args`: The objects to format, one per `{}`, in order
+    template <FixedString Fmt, typename... Args> requires(Printable<Args> &&...) void println(Args&&... args)
+    {
+        auto& buffer = detail::print_buffer();
+
+        buffer.clear();
+        detail::format_into<Fmt>(buffer, args...);
+        buffer.push_back('\n');
+
+        std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+    }
 } // namespace zinc
 
 #endif
@@ -26,12 +26,28 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstddef>
 #include <filesystem>
 #include <fstream>
 #include <iterator>
 #include <span>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 namespace zinc
 {
@@ -76,6 +92,8 @@ namespace zinc
         {}
     };
 
+    template <Charlike CharT> class BatchedFileWriter;
+
     /// RAII object that actually represents a **unique handle to a file**,
     /// instead of a file **stream**. Handles simple reads/writes with no B.S,
     /// meant for simple I/O with small files.
@@ -295,6 +313,56 @@ namespace zinc
             throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path());
         }
 
+        /// Appends a multi-part record to the file as one gather-write: every
+        /// span goes to the kernel in a single `writev` call (on POSIX) with no
+        /// intermediate concatenation, instead of copying the pieces into a
+        /// scratch buffer first. Updates the internal file content buffer like
+        /// the other write operations, and invalidates any previous
+        /// iterators/`string_view`s/pointers the same way.
+        ///
+        /// # Parameters
+        /// - `pieces`: The spans to write, back to back, in order
+        ///
+        /// # Returns
+        /// Returns `*this` to enable chaining
+        BasicFile& write_all(std::span<const std::span<const std::byte>> pieces)
+        {
+            update_contents();
+
+            if (!writable())
+            {
+                throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path());
+            }
+
+            // the gather-write goes through a raw appending handle, not the
+            // fstream - the entire point is skipping the stream's buffer-and-copy
+            gather_append(pieces);
+
+            // the write happened behind the fstream's back, so a full re-read
+            // is the honest way to get the cache back in sync
+            notify_changed();
+
+            return *this;
+        }
+
+        /// Returns a writer that batches appends to this file. Every `append`
+        /// on the writer goes into an in-memory buffer, and the whole buffer is
+        /// committed as **one** write operation - one freshness check, one
+        /// write to the kernel - when the writer is `flush`ed or leaves scope.
+        ///
+        /// `append` on the file itself pays the freshness stat and a stream
+        /// flush on every single call, which is the wrong shape for "hundreds
+        /// of small appends per cycle"; a batch makes that cost scale with
+        /// bytes written instead of with call count.
+        ///
+        /// The file must not be written through other means (including its own
+        /// `append`/`truncate`/`overwrite`) while a batch is outstanding, or
+        /// the batch will interleave with those writes on commit.
+        ///
+        /// # Returns
+        /// A `BatchedFileWriter` that commits to this file
+        [[nodiscard]] BatchedFileWriter<CharT> batched();
+
         /// Gets the file's length. Like `std::string`, it pays no mind to encoding.
         [[nodiscard]] size_type size() const noexcept { return data_.size(); }
 
@@ -391,6 +459,96 @@ namespace zinc
             return real_file_length();
         }
 
+#ifdef _WIN32
+        // appends every piece through a raw win32 handle. WriteFileGather
+        // demands unbuffered, page-aligned I/O, which is the wrong trade for a
+        // buffered file type - sequential WriteFile calls are the gather-write
+        // equivalent here
+        void gather_append(std::span<const std::span<const std::byte>> pieces)
+        {
+            auto* handle = ::CreateFileW(path_.c_str(),
+                FILE_APPEND_DATA,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL,
+                nullptr);
+
+            if (handle == INVALID_HANDLE_VALUE)
+            {
+                throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path_);
+            }
+
+            for (auto piece : pieces)
+            {
+                DWORD written = 0;
+
+                if (::WriteFile(handle, piece.data(), static_cast<DWORD>(piece.size()), &written, nullptr) == 0)
+                {
+                    ::CloseHandle(handle);
+
+                    throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path_);
+                }
+            }
+
+            ::CloseHandle(handle);
+        }
+#else
+        // appends every piece with as few writev calls as possible: one, unless
+        // there are more pieces than IOV_MAX or the kernel does a short write
+        void gather_append(std::span<const std::span<const std::byte>> pieces)
+        {
+            const auto fd = ::open(path_.c_str(), O_WRONLY | O_APPEND); // NOLINT: what the syscall is called
+
+            if (fd < 0)
+            {
+                throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path_);
+            }
+
+            std::vector<iovec> iov;
+            iov.reserve(std::min(pieces.size(), std::size_t{IOV_MAX}));
+
+            for (auto piece : pieces)
+            {
+                // zero-length pieces are dropped here so the cursor walk below
+                // always makes progress
+                if (!piece.empty())
+                {
+                    // iovec's base is mutable because readv shares the struct
+                    iov.push_back({const_cast<std::byte*>(piece.data()), piece.size()}); // NOLINT
+                }
+            }
+
+            for (auto* cursor = iov.data(); cursor != iov.data() + iov.size();)
+            {
+                const auto count = std::min<std::size_t>(iov.data() + iov.size() - cursor, IOV_MAX);
+                auto written = ::writev(fd, cursor, static_cast<int>(count));
+
+                if (written < 0)
+                {
+                    ::close(fd);
+
+                    throw BadFileOperation(detail::FileUnwritablePlaceholder{}, path_);
+                }
+
+                // walk past whatever the kernel took, including partial pieces
+                while (written > 0 && static_cast<std::size_t>(written) >= cursor->iov_len)
+                {
+                    written -= static_cast<decltype(written)>(cursor->iov_len);
+                    ++cursor;
+                }
+
+                if (written > 0)
+                {
+                    cursor->iov_base = static_cast<std::byte*>(cursor->iov_base) + written;
+                    cursor->iov_len -= static_cast<std::size_t>(written);
+                }
+            }
+
+            ::close(fd);
+        }
+#endif
+
         [[nodiscard]] pos_type real_file_length() const noexcept
         {
             file_->seekg(0, std::ios_base::end);
@@ -445,6 +603,102 @@ namespace zinc
         std::pair<bool, bool> readwrite_ = {true, true};
     };
 
+    /// Coalesces many small appends into one file write, in the same RAII
+    /// shape as `defer`: build one from `BasicFile::batched()`, `append` to it
+    /// as many times as needed, and the whole batch is committed when `flush()`
+    /// is called or when the writer is destroyed. Can not be copied or
+    /// re-assigned, although moving is permitted (the moved-from writer
+    /// commits nothing).
+    ///
+    /// Commit errors from the scope-exit path are swallowed, since destructors
+    /// can't throw; call `flush()` yourself wherever a failed commit needs to
+    /// be acted on.
+    template <Charlike CharT> class BatchedFileWriter
+    {
+    public:
+        BatchedFileWriter() = delete;
+
+        BatchedFileWriter(const BatchedFileWriter&) = delete;
+
+        BatchedFileWriter(BatchedFileWriter&& other) noexcept
+            : file_(std::exchange(other.file_, nullptr))
+            , buffer_(std::move(other.buffer_))
+        {}
+
+        /// Opens a batch against `file`. Throws `BadFileOperation` immediately
+        /// if the file isn't writable, instead of letting a whole batch
+        /// accumulate and fail at commit.
+        ///
+        /// # Parameters
+        /// - `file`: The file every `append` will eventually be committed to
+        explicit BatchedFileWriter(BasicFile<CharT>& file)
+            : file_(&file)
+        {
+            if (!file.writable())
+            {
+                throw BadFileOperation(detail::FileUnwritablePlaceholder{}, file.path());
+            }
+        }
+
+        BatchedFileWriter& operator=(const BatchedFileWriter&) = delete;
+
+        BatchedFileWriter& operator=(BatchedFileWriter&&) = delete;
+
+        /// Commits whatever is still buffered. Errors are swallowed here, see
+        /// the class docs.
+        ~BatchedFileWriter()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...) // NOLINT: a throwing destructor is strictly worse
+            {}
+        }
+
+        /// Appends `object` to the batch's in-memory buffer. Nothing touches
+        /// the file or the kernel until the batch commits.
+        ///
+        /// # Parameters
+        /// - `object`: The object to print. Requires a valid `<<`
+        ///             overload for `std::ostream`
+        ///
+        /// # Returns
+        /// Returns `*this` to enable chaining
+        template <Printable T> BatchedFileWriter& append(const T& object)
+        {
+            buffer_ << object;
+
+            return *this;
+        }
+
+        /// Commits the buffered batch to the file as one `append`: a single
+        /// freshness check and a single flushed write, however many `append`
+        /// calls went into the buffer. The buffer is emptied, so the writer
+        /// can keep accumulating the next batch.
+        void flush()
+        {
+            if (file_ != nullptr && !buffer_.view().empty())
+            {
+                file_->append(buffer_.view());
+
+                buffer_.str({});
+            }
+        }
+
+        /// Returns the number of characters waiting to be committed
+        [[nodiscard]] std::size_t pending() const noexcept { return buffer_.view().size(); }
+
+    private:
+        BasicFile<CharT>* file_;
+        std::basic_ostringstream<CharT> buffer_;
+    };
+
+    template <Charlike CharT> BatchedFileWriter<CharT> BasicFile<CharT>::batched()
+    {
+        return BatchedFileWriter<CharT>(*this);
+    }
+
     /// `BasicFile`s represent actual files, therefore there's no reason to compare anything except the paths.
     /// `BasicFile` paths are absolute, so no need to even do conversions there. Also, it doesn't really make sense
     /// to compare two files opened with different `CharT`s, and if it's really needed, comparison is possible
@@ -504,6 +758,313 @@ namespace zinc
 
         return std::move(file).content();
     }
+
+    /// Access-pattern hints for a `MappedFile`, forwarded to the OS so it can
+    /// tune read-ahead for the mapping (`madvise` on POSIX)
+    enum class MappedAccess
+    {
+        /// No particular pattern, the OS's default read-ahead
+        normal,
+        /// Front-to-back scans: aggressive read-ahead, pages behind the scan
+        /// can be dropped early
+        sequential,
+        /// Scattered point lookups: read-ahead is mostly wasted, so the OS
+        /// is told not to bother
+        random
+    };
+
+    /// A read-only view of an entire file through a memory mapping, for the
+    /// files `BasicFile` is explicitly not designed for. Nothing is copied and
+    /// no buffer is owned: the file's bytes are paged in on demand, and the
+    /// pages live in the OS page cache where every process mapping the same
+    /// file shares them. A 20GB reference file costs virtual address space,
+    /// not resident memory.
+    ///
+    /// The mapping is a snapshot of the file as it was opened in the loosest
+    /// sense: other writers mutating the file while it's mapped is a data race,
+    /// same as any shared memory. `MappedFile` does none of `BasicFile`'s
+    /// change tracking.
+    ///
+    /// Move-only, since the mapping is a unique resource like any other handle.
+    class MappedFile
+    {
+    public:
+        /// Needed for the same container-related reasons as `BasicFile`'s.
+        /// A default-constructed `MappedFile` maps nothing and is empty.
+        MappedFile() noexcept = default;
+
+        /// Maps an entire file into the process, read-only. Throws `BadFileOpen`
+        /// if the path is a directory or can't be opened, and `BadFileOperation`
+        /// if the file opens but the mapping itself fails.
+        ///
+        /// # Parameters
+        /// - `path`: The path to map
+        explicit MappedFile(std::filesystem::path path)
+            : path_(std::filesystem::absolute(path))
+        {
+            if (std::filesystem::is_directory(path_)) throw BadFileOpen(detail::CantOpenDirPlaceholder{}, path_);
+
+            map_whole_file();
+        }
+
+        MappedFile(const MappedFile&) = delete;
+
+        /// Takes over the other file's mapping, leaving it empty
+        MappedFile(MappedFile&& other) noexcept
+            : path_(std::move(other.path_))
+            , data_(std::exchange(other.data_, nullptr))
+            , size_(std::exchange(other.size_, 0))
+#ifdef _WIN32
+            , file_(std::exchange(other.file_, nullptr))
+            , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+        {}
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /// Unmaps the current mapping (if any) and takes over the other file's
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            auto moved = std::move(other);
+
+            swap(*this, moved);
+
+            return *this;
+        }
+
+        /// Unmaps the file. Every span/`string_view`/pointer handed out is
+        /// invalidated.
+        ~MappedFile() { unmap(); }
+
+        /// Gets the mapped file's length in bytes
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+        /// Checks if the mapped file has a length of 0
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /// Returns a pointer to the first mapped byte. Valid for `size()` bytes,
+        /// until the `MappedFile` is destroyed or moved-from.
+        [[nodiscard]] const std::byte* data() const noexcept { return static_cast<const std::byte*>(data_); }
+
+        /// Views the whole file as raw bytes, without copying any of them
+        [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {data(), size_}; }
+
+        /// Views the whole file as text, without copying any of it. No newline
+        /// conversion happens, unlike `BasicFile`: the bytes are exactly the
+        /// bytes on disk.
+        [[nodiscard]] std::string_view view() const noexcept
+        {
+            return {static_cast<const char*>(data_), size_};
+        }
+
+        [[nodiscard]] operator std::string_view() const noexcept { return view(); }
+
+        /// Tells the OS how the mapping is about to be accessed, so it can
+        /// read ahead (or stop reading ahead) accordingly. Purely an
+        /// optimization hint: access is correct whatever was advised.
+        ///
+        /// # Parameters
+        /// - `pattern`: The expected access pattern
+        void advise([[maybe_unused]] MappedAccess pattern) noexcept
+        {
+#ifndef _WIN32
+            if (data_ == nullptr)
+            {
+                return;
+            }
+
+            auto advice = POSIX_MADV_NORMAL;
+
+            switch (pattern)
+            {
+                case MappedAccess::sequential: advice = POSIX_MADV_SEQUENTIAL; break;
+                case MappedAccess::random: advice = POSIX_MADV_RANDOM; break;
+                default: break;
+            }
+
+            (void)::posix_madvise(data_, size_, advice);
+#endif
+            // no Windows equivalent of madvise for an existing view; the hint
+            // simply does nothing there
+        }
+
+        /// Returns the path of the mapped file, absolute like `BasicFile`'s
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+        /// Swaps two mapped files, mappings and all
+        friend void swap(MappedFile& lhs, MappedFile& rhs) noexcept
+        {
+            using std::swap;
+
+            swap(lhs.path_, rhs.path_);
+            swap(lhs.data_, rhs.data_);
+            swap(lhs.size_, rhs.size_);
+#ifdef _WIN32
+            swap(lhs.file_, rhs.file_);
+            swap(lhs.mapping_, rhs.mapping_);
+#endif
+        }
+
+    private:
+#ifdef _WIN32
+        void map_whole_file()
+        {
+            file_ = ::CreateFileW(path_.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL,
+                nullptr);
+
+            if (file_ == INVALID_HANDLE_VALUE)
+            {
+                file_ = nullptr;
+
+                throw BadFileOpen(detail::AccessDeniedPlaceholder{}, path_);
+            }
+
+            LARGE_INTEGER length;
+
+            // every throw below goes through unmap() first: the constructor is
+            // the thing throwing, so the destructor will never run to release
+            // whatever handles were already opened
+            if (::GetFileSizeEx(file_, &length) == 0)
+            {
+                unmap();
+
+                throw BadFileOperation(detail::FileUnreadablePlaceholder{}, path_);
+            }
+
+            // zero-length mappings are outright rejected by the API, an empty
+            // file just stays unmapped
+            if (length.QuadPart == 0)
+            {
+                return;
+            }
+
+            mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (mapping_ == nullptr)
+            {
+                unmap();
+
+                throw BadFileOperation(detail::FileUnreadablePlaceholder{}, path_);
+            }
+
+            data_ = ::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+
+            if (data_ == nullptr)
+            {
+                unmap();
+
+                throw BadFileOperation(detail::FileUnreadablePlaceholder{}, path_);
+            }
+
+            size_ = static_cast<std::size_t>(length.QuadPart);
+        }
+
+        void unmap() noexcept
+        {
+            if (data_ != nullptr) ::UnmapViewOfFile(data_);
+
+            if (mapping_ != nullptr) ::CloseHandle(mapping_);
+
+            if (file_ != nullptr) ::CloseHandle(file_);
+
+            data_ = nullptr;
+            mapping_ = nullptr;
+            file_ = nullptr;
+            size_ = 0;
+        }
+#else
+        void map_whole_file()
+        {
+            const auto fd = ::open(path_.c_str(), O_RDONLY); // NOLINT: what the syscall is called
+
+            if (fd < 0)
+            {
+                throw BadFileOpen(detail::AccessDeniedPlaceholder{}, path_);
+            }
+
+            struct stat info = {};
+
+            if (::fstat(fd, &info) != 0)
+            {
+                ::close(fd);
+
+                throw BadFileOperation(detail::FileUnreadablePlaceholder{}, path_);
+            }
+
+            // mmap rejects zero-length mappings, an empty file just stays unmapped
+            if (info.st_size == 0)
+            {
+                ::close(fd);
+
+                return;
+            }
+
+            auto* mapped = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+            // the mapping holds its own reference to the file, the descriptor
+            // has done its job either way
+            ::close(fd);
+
+            if (mapped == MAP_FAILED) // NOLINT: how the API reports failure
+            {
+                throw BadFileOperation(detail::FileUnreadablePlaceholder{}, path_);
+            }
+
+            data_ = mapped;
+            size_ = static_cast<std::size_t>(info.st_size);
+        }
+
+        void unmap() noexcept
+        {
+            if (data_ != nullptr) ::munmap(data_, size_);
+
+            data_ = nullptr;
+            size_ = 0;
+        }
+#endif
+
+        std::filesystem::path path_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        void* file_ = nullptr; // HANDLEs, but kept as void* so they line up with the POSIX members
+        void* mapping_ = nullptr;
+#endif
+    };
+
+    /// Same path-based comparison as `BasicFile`'s: two `MappedFile`s are
+    /// views of actual files, so compare which file they view
+    ///
+    /// # Parameters
+    /// - `lhs`: First file to compare
+    /// - `rhs`: Second file to compare
+    ///
+    /// # Returns
+    /// Whether both mappings view the same file
+    [[nodiscard]] inline bool operator==(const MappedFile& lhs, const MappedFile& rhs)
+    {
+        return lhs.path() == rhs.path();
+    }
+
+    /// Convenience function for mapping a file and hinting the access pattern
+    /// in one go
+    ///
+    /// # Parameters:
+    /// - `path`: The path to map
+    /// - `pattern`: How the mapping is going to be read
+    inline MappedFile map_file(std::filesystem::path path, MappedAccess pattern = MappedAccess::normal)
+    {
+        auto file = MappedFile(std::move(path));
+
+        file.advise(pattern);
+
+        return file;
+    }
 } // namespace zinc
 
 #endif
\ No newline at end of file
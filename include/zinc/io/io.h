@@ -19,8 +19,12 @@
 #ifndef ZINC_IO_IO
 #define ZINC_IO_IO
 
+#include "zinc/io/async_file.h"
+#include "zinc/io/async_log.h"
 #include "zinc/io/concepts.h"
 #include "zinc/io/console.h"
 #include "zinc/io/file.h"
+#include "zinc/io/split.h"
+#include "zinc/io/streaming_file.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,222 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_IO_SPLIT
+#define ZINC_IO_SPLIT
+
+#include "zinc/io/file.h"
+#include "zinc/types/concepts.h"
+#include "zinc/types/strings.h"
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+namespace zinc
+{
+    namespace detail
+    {
+        struct EmptyYieldsNothingPlaceholder
+        {};
+
+        template <Charlike CharT> struct SplittingIterator
+        {
+            using View = std::basic_string_view<CharT>;
+            using value_type = View;
+            using difference_type = std::ptrdiff_t;
+
+            // a default-constructed iterator is the past-the-end state
+            SplittingIterator() noexcept = default;
+
+            SplittingIterator(View text, CharT delim) noexcept
+                : rest_(text)
+                , delim_(delim)
+                , done_(false)
+            {
+                ++*this;
+            }
+
+            [[nodiscard]] View operator*() const noexcept { return current_; }
+
+            [[nodiscard]] bool operator==(const SplittingIterator& other) const noexcept
+            {
+                // two iterators into the same text are equal iff they have the
+                // same amount left to chew through; done iterators match the
+                // default-constructed sentinel
+                return done_ == other.done_ && (done_ || rest_.data() == other.rest_.data());
+            }
+
+            SplittingIterator& operator++() noexcept
+            {
+                if (exhausted_)
+                {
+                    done_ = true;
+
+                    return *this;
+                }
+
+                const auto pos = rest_.find(delim_);
+
+                if (pos == View::npos)
+                {
+                    // the final token runs to the end of the text, delimiter or no
+                    current_ = rest_;
+                    exhausted_ = true;
+                }
+                else
+                {
+                    current_ = rest_.substr(0, pos);
+                    rest_.remove_prefix(pos + 1);
+                }
+
+                return *this;
+            }
+
+            SplittingIterator operator++(int) noexcept
+            {
+                const auto copy = *this;
+
+                ++*this;
+
+                return copy;
+            }
+
+        private:
+            View rest_;
+            View current_;
+            CharT delim_ = CharT{};
+            bool done_ = true;
+            bool exhausted_ = false;
+        };
+    } // namespace detail
+
+    /// A lazy, zero-copy splitter: a range of `basic_string_view`s into the
+    /// text it was built over, one token per delimiter-separated piece. Each
+    /// byte of the text is looked at exactly once, and nothing is allocated -
+    /// the views point into the original buffer, so they live exactly as long
+    /// as it does.
+    ///
+    /// Composes with the other iterator utilities:
+    /// ```cpp
+    /// auto tokens = zinc::split(text, ',');
+    ///
+    /// for (auto [i, token] : zinc::enumerate(tokens)) {
+    ///     std::cout << "field " << i << ": " << token << '\n';
+    /// }
+    /// ```
+    template <Charlike CharT> class SplitAdapter
+    {
+    public:
+        SplitAdapter() noexcept = delete;
+
+        SplitAdapter(std::basic_string_view<CharT> text, CharT delim) noexcept
+            : text_(text)
+            , delim_(delim)
+        {}
+
+        SplitAdapter(detail::EmptyYieldsNothingPlaceholder, std::basic_string_view<CharT> text, CharT delim) noexcept
+            : text_(text)
+            , delim_(delim)
+            , empty_yields_nothing_(true)
+        {}
+
+        SplitAdapter(const SplitAdapter&) noexcept = default;
+
+        SplitAdapter(SplitAdapter&&) noexcept = default;
+
+        SplitAdapter& operator=(const SplitAdapter&) noexcept = default;
+
+        SplitAdapter& operator=(SplitAdapter&&) noexcept = default;
+
+        ~SplitAdapter() noexcept = default;
+
+        [[nodiscard]] auto begin() const noexcept
+        {
+            return empty_yields_nothing_ && text_.empty() ? end() : detail::SplittingIterator<CharT>{text_, delim_};
+        }
+
+        [[nodiscard]] auto end() const noexcept { return detail::SplittingIterator<CharT>{}; }
+
+    private:
+        std::basic_string_view<CharT> text_;
+        CharT delim_;
+        bool empty_yields_nothing_ = false; // `lines`-style ranges have no tokens at all in empty text
+    };
+
+    /// Lazily splits a string view on a delimiter, yielding views into it
+    /// rather than copies out of it. Follows `split` convention, not `lines`
+    /// convention: adjacent delimiters yield empty tokens, and text ending in
+    /// a delimiter yields a trailing empty token (`"a,,b,"` has the four
+    /// tokens `"a"`, `""`, `"b"`, `""`).
+    ///
+    /// # Parameters
+    /// - `text`: The text to split. Must outlive the returned views.
+    /// - `delim`: The delimiter to split on, which appears in no token
+    ///
+    /// # Returns
+    /// A lazy range of `basic_string_view<CharT>` tokens
+    template <Charlike CharT>
+    [[nodiscard]] constexpr SplitAdapter<CharT> split(std::basic_string_view<CharT> text, CharT delim) noexcept
+    {
+        return SplitAdapter<CharT>(text, delim);
+    }
+
+    /// Lazily iterates the lines of a block of text, as views into it. Unlike
+    /// raw `split`, a trailing newline is treated as terminating the last line
+    /// instead of starting a phantom empty one, which is what every
+    /// line-oriented file format means by "lines". `'\r'`s are left alone.
+    ///
+    /// # Parameters
+    /// - `text`: The text to iterate. Must outlive the returned views.
+    ///
+    /// # Returns
+    /// A lazy range of `basic_string_view<CharT>` lines, without their `'\n'`s
+    template <Charlike CharT>
+    [[nodiscard]] constexpr SplitAdapter<CharT> lines(std::basic_string_view<CharT> text) noexcept
+    {
+        // only text that was empty *before* the trim holds no lines at all.
+        // "\n" trims to the same empty view, but it's a real (empty) line
+        // that the trailing newline terminated, and has to be yielded
+        if (text.empty())
+        {
+            return SplitAdapter<CharT>(detail::EmptyYieldsNothingPlaceholder{}, text, CharT{'\n'});
+        }
+
+        if (text.back() == CharT{'\n'})
+        {
+            text.remove_suffix(1);
+        }
+
+        return SplitAdapter<CharT>(text, CharT{'\n'});
+    }
+
+    /// Lazily iterates the lines of a `BasicFile`'s contents, straight out of
+    /// the file's own buffer. The views obey `content()`'s invalidation rules:
+    /// any modifying operation on the file invalidates all of them.
+    ///
+    /// # Parameters
+    /// - `file`: The file whose lines to iterate
+    ///
+    /// # Returns
+    /// A lazy range of `basic_string_view<CharT>` lines, without their `'\n'`s
+    template <Charlike CharT> [[nodiscard]] SplitAdapter<CharT> lines(const BasicFile<CharT>& file) noexcept
+    {
+        return lines(file.content());
+    }
+} // namespace zinc
+
+#endif
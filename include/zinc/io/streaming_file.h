@@ -0,0 +1,195 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_IO_STREAMING_FILE
+#define ZINC_IO_STREAMING_FILE
+
+#include "zinc/io/file.h"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace zinc
+{
+    /// A front-to-back reader for files too large even to map comfortably,
+    /// where neither `BasicFile` nor `MappedFile` fits. The file is consumed
+    /// as fixed-size chunks through a double buffer: while the caller chews
+    /// on chunk N, a background read is already filling chunk N+1, so an
+    /// alternately I/O-bound and CPU-bound scan overlaps the two instead of
+    /// paying for them back to back.
+    ///
+    /// Strictly forward-only - there is no seeking, no writing, and each chunk
+    /// span is only valid until the next call to `next`. Exactly one chunk of
+    /// look-ahead is in flight at a time, so memory use is two chunks, total,
+    /// regardless of file size.
+    ///
+    /// Throws the same `BadFileOpen`/`BadFileOperation` as the rest of
+    /// `zinc/io`; read errors surface from the `next` call that would have
+    /// returned the failed chunk.
+    class StreamingFile
+    {
+    public:
+        /// The default chunk size: big enough to amortize syscalls and keep
+        /// read-ahead busy, small enough that two of them are noise
+        constexpr static std::size_t default_chunk_size = std::size_t{1} << 20;
+
+        /// Opens a file for streaming and immediately kicks off the read of
+        /// the first chunk. Throws `BadFileOpen` if the path is a directory or
+        /// can't be opened.
+        ///
+        /// # Parameters
+        /// - `path`: The path to stream
+        /// - `chunk_size`: How many bytes each chunk holds
+        explicit StreamingFile(std::filesystem::path path, std::size_t chunk_size = default_chunk_size)
+        {
+            auto state = std::make_unique<State>();
+            state->path = std::filesystem::absolute(path);
+
+            if (std::filesystem::is_directory(state->path))
+            {
+                throw BadFileOpen(detail::CantOpenDirPlaceholder{}, state->path);
+            }
+
+            state->stream.open(state->path, std::ios_base::in | std::ios_base::binary);
+
+            if (!state->stream.is_open())
+            {
+                throw BadFileOpen(detail::AccessDeniedPlaceholder{}, state->path);
+            }
+
+            state->front.resize(chunk_size);
+            state->back.resize(chunk_size);
+            state_ = std::move(state);
+
+            start_read_ahead();
+        }
+
+        StreamingFile(const StreamingFile&) = delete;
+
+        /// Takes over the other reader's stream and any in-flight read. The
+        /// state lives behind a pointer, so the background read doesn't care
+        /// which object it reports to.
+        StreamingFile(StreamingFile&&) noexcept = default;
+
+        StreamingFile& operator=(const StreamingFile&) = delete;
+
+        /// Waits out this reader's own in-flight read before taking over the
+        /// other's, since the read targets the state about to be released
+        StreamingFile& operator=(StreamingFile&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (pending_.valid()) pending_.wait();
+
+                state_ = std::move(other.state_);
+                pending_ = std::move(other.pending_);
+            }
+
+            return *this;
+        }
+
+        /// Waits out any in-flight read-ahead, then closes the file
+        ~StreamingFile() = default;
+
+        /// Hands out the next chunk of the file, blocking only for however
+        /// much of its read-ahead hasn't finished yet, and starts reading the
+        /// chunk after it in the background. The final chunk is however many
+        /// bytes were left; after that (and for an empty file), returns an
+        /// empty span.
+        ///
+        /// The returned span is invalidated by the next call to `next` - the
+        /// buffer it views is the one the read-ahead fills next.
+        ///
+        /// # Returns
+        /// The next `chunk_size()` (or fewer, at the end) bytes of the file
+        [[nodiscard]] std::span<const std::byte> next()
+        {
+            if (!pending_.valid())
+            {
+                return {};
+            }
+
+            // propagates any BadFileOperation the background read hit
+            const auto filled = pending_.get();
+
+            if (filled == 0)
+            {
+                return {};
+            }
+
+            // the freshly-filled buffer becomes the caller's, the old one
+            // becomes the read-ahead target
+            std::swap(state_->front, state_->back);
+
+            // a short chunk means the file ended inside it, nothing left to read
+            if (filled == chunk_size())
+            {
+                start_read_ahead();
+            }
+
+            return {state_->front.data(), filled};
+        }
+
+        /// Gets the size every chunk but the last is, in bytes
+        [[nodiscard]] std::size_t chunk_size() const noexcept { return state_->front.size(); }
+
+        /// Checks whether the whole file has been handed out. Once true,
+        /// `next` only returns empty spans.
+        [[nodiscard]] bool exhausted() const noexcept { return !pending_.valid(); }
+
+        /// Returns the path of the file being streamed, absolute like the rest
+        /// of `zinc/io`'s
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return state_->path; }
+
+    private:
+        // everything the background read touches, kept at a stable address so
+        // moving the StreamingFile can't pull the rug out from under it
+        struct State
+        {
+            std::filesystem::path path;
+            std::ifstream stream;
+            std::vector<std::byte> front;
+            std::vector<std::byte> back;
+        };
+
+        void start_read_ahead()
+        {
+            pending_ = std::async(std::launch::async, [state = state_.get()] {
+                state->stream.read(reinterpret_cast<char*>(state->back.data()),
+                    static_cast<std::streamsize>(state->back.size()));
+
+                if (state->stream.bad())
+                {
+                    throw BadFileOperation(detail::FileUnreadablePlaceholder{}, state->path);
+                }
+
+                return static_cast<std::size_t>(state->stream.gcount());
+            });
+        }
+
+        std::unique_ptr<State> state_;
+        std::future<std::size_t> pending_; // after state_, so destruction waits out the read first
+    };
+} // namespace zinc
+
+#endif
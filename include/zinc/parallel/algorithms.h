@@ -0,0 +1,315 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_PARALLEL_ALGORITHMS
+#define ZINC_PARALLEL_ALGORITHMS
+
+#include "zinc/parallel/thread_pool.h"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <latch>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace zinc
+{
+    namespace detail
+    {
+        // below this many elements the chunking bookkeeping costs more than
+        // the threads save, so the algorithms just run inline
+        constexpr inline std::size_t min_parallel_size = 1024;
+
+        // more chunks than workers so a worker that finishes early has
+        // something to steal, few enough that each chunk pays for its task
+        constexpr inline std::size_t chunks_per_worker = 8;
+
+        template <typename Iterator> struct RangeChunk
+        {
+            Iterator first;
+            std::size_t length;
+        };
+
+        // counted by walking because zinc's own range iterators (and any
+        // other forward-only ones) don't support subtraction
+        template <typename Iterator> [[nodiscard]] std::size_t count_of(Iterator first, Iterator last)
+        {
+            auto count = std::size_t{0};
+
+            for (auto it = first; it != last; ++it)
+            {
+                ++count;
+            }
+
+            return count;
+        }
+
+        template <typename Iterator>
+        [[nodiscard]] std::vector<RangeChunk<Iterator>> chunks_of(Iterator first, std::size_t total, std::size_t workers)
+        {
+            const auto grain = std::max(total / (workers * chunks_per_worker), std::size_t{1});
+            auto chunks = std::vector<RangeChunk<Iterator>>();
+            chunks.reserve(total / grain + 1);
+
+            auto it = first;
+            auto remaining = total;
+
+            while (remaining > 0)
+            {
+                const auto length = std::min(grain, remaining);
+
+                chunks.push_back({it, length});
+
+                for (auto i = std::size_t{0}; i < length; ++i)
+                {
+                    ++it;
+                }
+
+                remaining -= length;
+            }
+
+            return chunks;
+        }
+
+        [[nodiscard]] inline bool should_run_inline(ThreadPool& pool, std::size_t total)
+        {
+            // inside a worker the caller *is* the pool - blocking it on its
+            // own pool's work is a deadlock, so nested calls degrade to serial
+            return total <= min_parallel_size || pool.worker_count() == 1 || pool.on_worker_thread();
+        }
+    } // namespace detail
+
+    /// Applies `fn` to every element of `range`, fanning the work out across
+    /// the pool in automatically sized contiguous chunks and returning once
+    /// every element has been visited. A serial loop like
+    /// `for (auto i : zinc::range_of(0uz, n))` drops in as
+    /// `zinc::parallel_for_each(pool, zinc::range_of(0uz, n), body)`.
+    ///
+    /// Chunks run concurrently, so `fn` must be safe to call from several
+    /// threads at once; elements *within* a chunk are visited in order. Small
+    /// ranges, one-worker pools, and calls made from inside a pool task all
+    /// run inline instead.
+    ///
+    /// # Parameters
+    /// - `pool`: The pool to run the chunks on
+    /// - `range`: The range whose elements get visited
+    /// - `fn`: The callable applied to each element
+    template <typename R, typename Fn> void parallel_for_each(ThreadPool& pool, R&& range, Fn fn)
+    {
+        auto first = std::begin(range);
+        auto last = std::end(range);
+        const auto total = detail::count_of(first, last);
+
+        if (detail::should_run_inline(pool, total))
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                fn(*it);
+            }
+
+            return;
+        }
+
+        const auto chunks = detail::chunks_of(first, total, pool.worker_count());
+        auto done = std::latch(static_cast<std::ptrdiff_t>(chunks.size()));
+
+        for (const auto& chunk : chunks)
+        {
+            pool.submit([chunk, fn, &done] {
+                auto it = chunk.first;
+
+                for (auto i = std::size_t{0}; i < chunk.length; ++i, ++it)
+                {
+                    fn(*it);
+                }
+
+                done.count_down();
+            });
+        }
+
+        done.wait();
+    }
+
+    /// `parallel_for_each` on the shared pool
+    ///
+    /// # Parameters
+    /// - `range`: The range whose elements get visited
+    /// - `fn`: The callable applied to each element
+    template <typename R, typename Fn> void parallel_for_each(R&& range, Fn fn)
+    {
+        parallel_for_each(ThreadPool::shared(), std::forward<R>(range), std::move(fn));
+    }
+
+    /// Writes `fn(element)` for every element of `range` into the sequence
+    /// starting at `out`, in order, chunked across the pool like
+    /// `parallel_for_each`. The output must already have room for every
+    /// result, and `out` must be a forward iterator (chunks need their own
+    /// independent cursors into it) - an iterator into a pre-sized `Vec` or
+    /// `std::vector` is the usual thing.
+    ///
+    /// # Parameters
+    /// - `pool`: The pool to run the chunks on
+    /// - `range`: The range whose elements get transformed
+    /// - `out`: Where the results go, one per element
+    /// - `fn`: The callable applied to each element
+    ///
+    /// # Returns
+    /// The output iterator one past the last result
+    template <typename R, typename OutIt, typename Fn>
+    OutIt parallel_transform(ThreadPool& pool, R&& range, OutIt out, Fn fn)
+    {
+        auto first = std::begin(range);
+        auto last = std::end(range);
+        const auto total = detail::count_of(first, last);
+
+        if (detail::should_run_inline(pool, total))
+        {
+            for (auto it = first; it != last; ++it, ++out)
+            {
+                *out = fn(*it);
+            }
+
+            return out;
+        }
+
+        const auto chunks = detail::chunks_of(first, total, pool.worker_count());
+        auto done = std::latch(static_cast<std::ptrdiff_t>(chunks.size()));
+        auto chunk_out = out;
+
+        for (const auto& chunk : chunks)
+        {
+            pool.submit([chunk, chunk_out, fn, &done] {
+                auto it = chunk.first;
+                auto dst = chunk_out;
+
+                for (auto i = std::size_t{0}; i < chunk.length; ++i, ++it, ++dst)
+                {
+                    *dst = fn(*it);
+                }
+
+                done.count_down();
+            });
+
+            for (auto i = std::size_t{0}; i < chunk.length; ++i)
+            {
+                ++chunk_out;
+            }
+        }
+
+        done.wait();
+
+        return chunk_out;
+    }
+
+    /// `parallel_transform` on the shared pool
+    ///
+    /// # Parameters
+    /// - `range`: The range whose elements get transformed
+    /// - `out`: Where the results go, one per element
+    /// - `fn`: The callable applied to each element
+    ///
+    /// # Returns
+    /// The output iterator one past the last result
+    template <typename R, typename OutIt, typename Fn> OutIt parallel_transform(R&& range, OutIt out, Fn fn)
+    {
+        return parallel_transform(ThreadPool::shared(), std::forward<R>(range), std::move(out), std::move(fn));
+    }
+
+    /// Folds `range` down to one value with `op`, reducing each chunk on its
+    /// own worker and combining the partial results (and `init`, exactly
+    /// once) on the calling thread. `op` must be associative - chunk
+    /// boundaries regroup the fold - but the elements within and across
+    /// chunks stay in range order, so it needn't be commutative.
+    ///
+    /// # Parameters
+    /// - `pool`: The pool to run the chunks on
+    /// - `range`: The range to fold
+    /// - `init`: The starting value, folded in exactly once
+    /// - `op`: The fold, called as `op(accumulator, element)`
+    ///
+    /// # Returns
+    /// `init` folded with every element of the range
+    template <typename R, typename T, typename Op> [[nodiscard]] T parallel_reduce(ThreadPool& pool, R&& range, T init, Op op)
+    {
+        auto first = std::begin(range);
+        auto last = std::end(range);
+        const auto total = detail::count_of(first, last);
+
+        if (detail::should_run_inline(pool, total))
+        {
+            auto accumulator = std::move(init);
+
+            for (auto it = first; it != last; ++it)
+            {
+                accumulator = op(std::move(accumulator), *it);
+            }
+
+            return accumulator;
+        }
+
+        const auto chunks = detail::chunks_of(first, total, pool.worker_count());
+        // optionals so `T` doesn't need to be default-constructible; every
+        // chunk is non-empty, so every slot gets filled
+        auto partials = std::vector<std::optional<T>>(chunks.size());
+        auto done = std::latch(static_cast<std::ptrdiff_t>(chunks.size()));
+
+        for (auto index = std::size_t{0}; index < chunks.size(); ++index)
+        {
+            pool.submit([chunk = chunks[index], partial = &partials[index], op, &done] {
+                auto it = chunk.first;
+                auto accumulator = T(*it);
+
+                for (auto i = std::size_t{1}; i < chunk.length; ++i)
+                {
+                    accumulator = op(std::move(accumulator), *++it);
+                }
+
+                partial->emplace(std::move(accumulator));
+                done.count_down();
+            });
+        }
+
+        done.wait();
+
+        auto result = std::move(init);
+
+        for (auto& partial : partials)
+        {
+            result = op(std::move(result), std::move(*partial));
+        }
+
+        return result;
+    }
+
+    /// `parallel_reduce` on the shared pool
+    ///
+    /// # Parameters
+    /// - `range`: The range to fold
+    /// - `init`: The starting value, folded in exactly once
+    /// - `op`: The fold, called as `op(accumulator, element)`
+    ///
+    /// # Returns
+    /// `init` folded with every element of the range
+    template <typename R, typename T, typename Op> [[nodiscard]] T parallel_reduce(R&& range, T init, Op op)
+    {
+        return parallel_reduce(ThreadPool::shared(), std::forward<R>(range), std::move(init), std::move(op));
+    }
+} // namespace zinc
+
+#endif
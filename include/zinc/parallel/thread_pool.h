@@ -0,0 +1,255 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_PARALLEL_THREAD_POOL
+#define ZINC_PARALLEL_THREAD_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace zinc
+{
+    /// A work-stealing thread pool: every worker owns a deque of tasks, runs
+    /// its own newest task first (it's the one still hot in cache), and when
+    /// its deque runs dry it steals the *oldest* task from another worker -
+    /// the one the owner would have gotten to last. Load balances itself
+    /// without every thread fighting over one shared queue.
+    ///
+    /// Tasks submitted from inside a worker land on that worker's own deque,
+    /// so a task that fans out into subtasks keeps them local until someone
+    /// idle steals a share.
+    ///
+    /// The pool is the engine underneath `parallel_for_each` and friends;
+    /// most code never touches it directly beyond maybe sizing one.
+    class ThreadPool
+    {
+    public:
+        using size_type = std::size_t;
+
+        /// Creates a pool with `workers` worker threads, or one per hardware
+        /// thread if `workers` is zero
+        ///
+        /// # Parameters
+        /// - `workers`: How many worker threads to spawn, `0` for automatic
+        explicit ThreadPool(size_type workers = 0)
+            : worker_count_(workers != 0 ? workers : std::max(size_type{std::thread::hardware_concurrency()}, size_type{1}))
+            , queues_(std::make_unique<WorkerQueue[]>(worker_count_))
+        {
+            workers_.reserve(worker_count_);
+
+            for (auto i = size_type{0}; i < worker_count_; ++i)
+            {
+                workers_.emplace_back([this, i] {
+                    run_worker(i);
+                });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+
+        ThreadPool(ThreadPool&&) = delete;
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /// Finishes every task already submitted, then joins the workers
+        ~ThreadPool()
+        {
+            {
+                auto lock = std::unique_lock(sleep_mutex_);
+
+                stop_ = true;
+            }
+
+            wake_.notify_all();
+
+            for (auto& worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        /// Hands a task to the pool. It runs on some worker thread at some
+        /// point; if the task throws, the exception escapes the worker and
+        /// terminates the program, so catch inside the task if that matters.
+        ///
+        /// # Parameters
+        /// - `task`: The callable to run
+        void submit(std::function<void()> task)
+        {
+            const auto index = home_queue_index();
+
+            // counted before it's visible, so a worker can never pop a task
+            // the count doesn't cover and drive `pending_` negative
+            pending_.fetch_add(1, std::memory_order_release);
+
+            {
+                auto lock = std::unique_lock(queues_[index].mutex);
+
+                queues_[index].tasks.push_back(std::move(task));
+            }
+
+            // passing through the sleep mutex before notifying is what makes
+            // the increment above un-missable: a worker that saw `pending_ == 0`
+            // either still holds the mutex (so this blocks until it's parked
+            // and the notify lands) or has already blocked. Notifying without
+            // it can fire between a worker's predicate check and its park, and
+            // the task sits until the next submit
+            {
+                auto lock = std::unique_lock(sleep_mutex_);
+            }
+
+            wake_.notify_one();
+        }
+
+        /// Gets the number of worker threads in the pool
+        [[nodiscard]] size_type worker_count() const noexcept { return worker_count_; }
+
+        /// Checks whether the calling thread is one of this pool's workers.
+        /// Blocking a worker on work it submitted to its own pool is how
+        /// pools deadlock - the parallel algorithms use this to go serial
+        /// instead when they're called from inside a task.
+        [[nodiscard]] bool on_worker_thread() const noexcept { return current_pool == this; }
+
+        /// Gets the process-wide pool that the pool-less overloads of the
+        /// parallel algorithms run on, created with one worker per hardware
+        /// thread the first time anything asks for it
+        static ThreadPool& shared()
+        {
+            static ThreadPool pool;
+
+            return pool;
+        }
+
+    private:
+        // padded so one worker hammering its own deque doesn't bounce the
+        // cache line holding its neighbor's
+        struct alignas(64) WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        [[nodiscard]] size_type home_queue_index() noexcept
+        {
+            // workers keep their own work local, outside threads spread
+            // submissions round-robin
+            return current_pool == this ? current_worker : next_.fetch_add(1, std::memory_order_relaxed) % worker_count_;
+        }
+
+        [[nodiscard]] std::optional<std::function<void()>> try_take(WorkerQueue& queue, bool newest)
+        {
+            auto lock = std::unique_lock(queue.mutex);
+
+            if (queue.tasks.empty())
+            {
+                return std::nullopt;
+            }
+
+            auto task = std::optional<std::function<void()>>();
+
+            if (newest)
+            {
+                task.emplace(std::move(queue.tasks.back()));
+                queue.tasks.pop_back();
+            }
+            else
+            {
+                task.emplace(std::move(queue.tasks.front()));
+                queue.tasks.pop_front();
+            }
+
+            pending_.fetch_sub(1, std::memory_order_release);
+
+            return task;
+        }
+
+        [[nodiscard]] std::optional<std::function<void()>> find_task(size_type self)
+        {
+            // own queue newest-first, then steal oldest-first from the others
+            if (auto task = try_take(queues_[self], true); task.has_value())
+            {
+                return task;
+            }
+
+            for (auto i = size_type{1}; i < worker_count_; ++i)
+            {
+                if (auto task = try_take(queues_[(self + i) % worker_count_], false); task.has_value())
+                {
+                    return task;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        void run_worker(size_type self)
+        {
+            current_pool = this;
+            current_worker = self;
+
+            for (;;)
+            {
+                if (auto task = find_task(self); task.has_value())
+                {
+                    (*task)();
+
+                    continue;
+                }
+
+                auto lock = std::unique_lock(sleep_mutex_);
+
+                wake_.wait(lock, [this] {
+                    return stop_ || pending_.load(std::memory_order_acquire) > 0;
+                });
+
+                if (stop_ && pending_.load(std::memory_order_acquire) == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        inline static thread_local ThreadPool* current_pool = nullptr;
+        inline static thread_local size_type current_worker = 0;
+
+        size_type worker_count_;
+        std::unique_ptr<WorkerQueue[]> queues_;
+        std::vector<std::thread> workers_;
+        std::atomic<size_type> next_ = 0;
+        // counts tasks submitted but not yet claimed, i.e. "is there anything
+        // worth waking up for"
+        std::atomic<size_type> pending_ = 0;
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        bool stop_ = false;
+    };
+} // namespace zinc
+
+#endif
@@ -21,22 +21,13 @@
 
 #include "zinc/types/concepts.h"
 #include "zinc/types/pointers.h"
+#include "zinc/types/storage.h"
 #include <cstddef>
 #include <memory>
 #include <type_traits>
 
 namespace zinc
 {
-    namespace detail
-    {
-        template <typename T> struct PerfectlySizedStorage
-        {
-            alignas(T) std::byte storage[sizeof(T)];
-
-            T* as() noexcept { return pointer_cast<T*>(storage); }
-        };
-    } // namespace detail
-
     /// Signed word-sized integer type
     using SignedWord = std::make_signed_t<std::size_t>;
 
@@ -50,7 +41,7 @@ namespace zinc
     template <HasPosType T> using PosT = typename T::pos_type;
 
     /// Gets storage that's the perfect size and alignment for
-    template <typename T> using AlignedStorageFor = detail::PerfectlySizedStorage<T>;
+    template <typename T> using AlignedStorageFor = StorageFor<T>;
 } // namespace zinc
 
 #endif
\ No newline at end of file
@@ -0,0 +1,204 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_TYPES_ALLOCATORS_ARENA
+#define ZINC_TYPES_ALLOCATORS_ARENA
+
+#include "zinc/types/allocators.h"
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace zinc
+{
+    /// A region of memory that only ever grows: allocations bump a cursor
+    /// through large chunks, nothing is ever freed individually, and `reset()`
+    /// reclaims everything at once in O(1) by rewinding the cursor. The chunks
+    /// themselves are kept and re-used across resets.
+    ///
+    /// Made for the "build thousands of short-lived structures, then drop them
+    /// all" shape of work: point an `ArenaAllocator` at an arena, let the
+    /// containers fill it, reset between batches.
+    ///
+    /// Objects placed in the arena do NOT get their destructors run by
+    /// `reset()` - only trivially-destructible contents (or contents whose
+    /// destructors were already run by their containers) are safe to drop.
+    class Arena
+    {
+    public:
+        /// The default size of each chunk the arena bumps through
+        constexpr static std::size_t default_chunk_size = std::size_t{64} * 1024;
+
+        /// Creates an arena that grows `chunk_size` bytes at a time
+        ///
+        /// # Parameters
+        /// - `chunk_size`: The size of each chunk, larger requests get their own
+        explicit Arena(std::size_t chunk_size = default_chunk_size) noexcept
+            : chunk_size_(chunk_size)
+        {}
+
+        Arena(const Arena&) = delete;
+
+        Arena& operator=(const Arena&) = delete;
+
+        ~Arena()
+        {
+            for (const auto& [ptr, size] : chunks_)
+            {
+                ::operator delete(ptr, std::align_val_t{chunk_align});
+            }
+        }
+
+        /// Carves `bytes` out of the current chunk, moving on to the next one
+        /// (or a brand new one) when it doesn't fit
+        ///
+        /// # Parameters
+        /// - `bytes`: The number of bytes to allocate
+        /// - `align`: The required alignment, at most `chunk_align`
+        ///
+        /// # Returns
+        /// A pointer into the arena, alive until `reset()` or destruction
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t align)
+        {
+            assert("over-aligned types don't fit in an arena chunk" && align <= chunk_align);
+
+            while (true)
+            {
+                if (current_ < chunks_.size())
+                {
+                    const auto& [ptr, size] = chunks_[current_];
+                    const auto aligned = (offset_ + (align - 1)) & ~(align - 1);
+
+                    if (aligned + bytes <= size)
+                    {
+                        offset_ = aligned + bytes;
+
+                        return static_cast<std::byte*>(ptr) + aligned;
+                    }
+
+                    // this chunk is exhausted (or was always too small for this
+                    // request), move along. Post-reset this walks back through
+                    // the chunks we already own instead of allocating
+                    ++current_;
+                    offset_ = 0;
+
+                    continue;
+                }
+
+                const auto size = std::max(bytes, chunk_size_);
+
+                chunks_.emplace_back(::operator new(size, std::align_val_t{chunk_align}), size);
+            }
+        }
+
+        /// Reclaims every allocation at once by rewinding the cursor to the
+        /// first chunk. O(1), and the chunks stick around for the next batch.
+        void reset() noexcept
+        {
+            current_ = 0;
+            offset_ = 0;
+        }
+
+        /// Gets the total number of bytes of chunk space the arena owns
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            auto total = std::size_t{0};
+
+            for (const auto& [ptr, size] : chunks_)
+            {
+                total += size;
+            }
+
+            return total;
+        }
+
+    private:
+        // every chunk is aligned like this, so any request up to it can be
+        // served by aligning the cursor alone
+        constexpr static std::size_t chunk_align = alignof(std::max_align_t);
+
+        std::size_t chunk_size_;
+        std::vector<std::pair<void*, std::size_t>> chunks_;
+        std::size_t current_ = 0;
+        std::size_t offset_ = 0;
+    };
+
+    /// The `Allocator`-concept handle onto an `Arena`: drops straight into
+    /// `HashMap<K, V, Hash, Eq, ArenaAllocator<std::pair<const K, V>>>` and
+    /// friends. `deallocate` is a no-op - memory comes back when the arena is
+    /// reset - so per-element erase churn *grows* the arena and belongs in a
+    /// pool instead.
+    ///
+    /// Copies (and rebinds, which the containers do internally) all point at
+    /// the same arena. The arena must outlive every container using it.
+    template <typename T> class ArenaAllocator
+    {
+        template <typename U> friend class ArenaAllocator;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        /// Creates an unbound allocator. Usable only as a placeholder, it
+        /// asserts if anything actually allocates through it
+        ArenaAllocator() = default;
+
+        /// Creates an allocator serving from `arena`
+        ///
+        /// # Parameters
+        /// - `arena`: The arena to carve allocations out of
+        explicit ArenaAllocator(Arena& arena) noexcept
+            : arena_(&arena)
+        {}
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept // NOLINT: implicit by design, like all rebinds
+            : arena_(other.arena_)
+        {}
+
+        /// Bumps the arena cursor far enough for `n` objects
+        ///
+        /// # Parameters
+        /// - `n`: The number of objects to make room for
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            assert("allocating through an ArenaAllocator bound to an arena" && arena_ != nullptr);
+
+            return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /// Does nothing: arena memory only comes back via `Arena::reset`
+        void deallocate(T*, std::size_t) noexcept {}
+
+        /// Two arena allocators are interchangeable exactly when they share an arena
+        template <typename U> [[nodiscard]] bool operator==(const ArenaAllocator<U>& other) const noexcept
+        {
+            return arena_ == other.arena_;
+        }
+
+    private:
+        Arena* arena_ = nullptr;
+    };
+} // namespace zinc
+
+#endif
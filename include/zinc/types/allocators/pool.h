@@ -0,0 +1,195 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_TYPES_ALLOCATORS_POOL
+#define ZINC_TYPES_ALLOCATORS_POOL
+
+#include "zinc/types/allocators.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace zinc
+{
+    namespace detail
+    {
+        /// A pool of fixed-size nodes carved out of large chunks: one real
+        /// allocation serves a few thousand nodes, and freed nodes go onto a free
+        /// list for re-use. This is what keeps node-based containers from paying
+        /// one trip to the global allocator per element.
+        ///
+        /// Not thread-safe, like the containers built on top of it.
+        class NodePool
+        {
+        public:
+            /// How many nodes each chunk holds, i.e how many node allocations are
+            /// amortized over one real allocator call
+            constexpr static std::size_t nodes_per_chunk = 2048;
+
+            /// Creates a pool serving nodes of one exact size and alignment
+            ///
+            /// # Parameters
+            /// - `size`: The node size, in bytes
+            /// - `align`: The node alignment
+            NodePool(std::size_t size, std::size_t align) noexcept
+                : size_(size)
+                , stride_(std::max(size, sizeof(FreeNode)))
+                , align_(std::max(align, alignof(FreeNode)))
+            {}
+
+            NodePool(const NodePool&) = delete;
+
+            NodePool& operator=(const NodePool&) = delete;
+
+            ~NodePool()
+            {
+                for (auto* chunk : chunks_)
+                {
+                    ::operator delete(chunk, std::align_val_t{align_});
+                }
+            }
+
+            /// Checks whether a request for `bytes` at `align` is one of this
+            /// pool's nodes, as opposed to some unrelated allocation that has to
+            /// go straight to the heap
+            ///
+            /// # Parameters
+            /// - `bytes`: The size of the request
+            /// - `align`: The alignment of the request
+            [[nodiscard]] bool serves(std::size_t bytes, std::size_t align) const noexcept
+            {
+                return bytes == size_ && align <= align_;
+            }
+
+            /// Hands out one node, re-using a freed one when possible and bumping
+            /// into the current chunk otherwise
+            [[nodiscard]] void* allocate_node()
+            {
+                if (free_ != nullptr)
+                {
+                    return std::exchange(free_, free_->next);
+                }
+
+                if (bumped_ == nodes_per_chunk)
+                {
+                    chunks_.push_back(::operator new(stride_ * nodes_per_chunk, std::align_val_t{align_}));
+                    bumped_ = 0;
+                }
+
+                return static_cast<std::byte*>(chunks_.back()) + (bumped_++) * stride_;
+            }
+
+            /// Returns a node to the pool's free list. The chunk it came from is
+            /// only given back to the heap when the pool itself dies.
+            ///
+            /// # Parameters
+            /// - `node`: The node to free, must have come from `allocate_node`
+            void deallocate_node(void* node) noexcept { free_ = ::new (node) FreeNode{free_}; }
+
+        private:
+            struct FreeNode
+            {
+                FreeNode* next;
+            };
+
+            std::size_t size_;
+            std::size_t stride_; // nodes double as free-list links once dead, so at least pointer-sized
+            std::size_t align_;
+            std::vector<void*> chunks_;
+            std::size_t bumped_ = nodes_per_chunk; // forces the first chunk on first use
+            FreeNode* free_ = nullptr;
+        };
+
+    } // namespace detail
+
+    /// An allocator that serves single-object allocations of `T` out of slabs:
+    /// a shared `detail::NodePool` carves a few thousand nodes out of each real
+    /// allocation, freed nodes go onto an intrusive free list, and there is no
+    /// per-allocation metadata at all. `allocate`/`deallocate` are both O(1).
+    ///
+    /// Anything that isn't a single pool-sized node (like a hash table's slot
+    /// arrays, when rebound) goes straight to the heap instead, and rebound
+    /// copies share the pool, which stays sized for the original `T` - so the
+    /// allocator composes with `AllocRebind` and the container traits as-is.
+    /// Exactly what long-lived structures churning same-sized nodes want, where
+    /// an arena would grow without bound.
+    template <typename T> class PoolAllocator
+    {
+        template <typename U> friend class PoolAllocator;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        PoolAllocator()
+            : pool_(std::make_shared<detail::NodePool>(sizeof(T), alignof(T)))
+        {}
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept // NOLINT: implicit by design, like all rebinds
+            : pool_(other.pool_)
+        {}
+
+        /// Allocates space for `n` objects, pulling from the pool when the
+        /// request is exactly one pool-sized node
+        ///
+        /// # Parameters
+        /// - `n`: The number of objects to make room for
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            if (n == 1 && pool_->serves(sizeof(T), alignof(T)))
+            {
+                return static_cast<T*>(pool_->allocate_node());
+            }
+
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+
+        /// Frees an allocation previously made with `allocate`
+        ///
+        /// # Parameters
+        /// - `ptr`: The allocation to free
+        /// - `n`: The object count it was made with
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            if (n == 1 && pool_->serves(sizeof(T), alignof(T)))
+            {
+                pool_->deallocate_node(ptr);
+
+                return;
+            }
+
+            ::operator delete(ptr, std::align_val_t{alignof(T)});
+        }
+
+        /// Two pool allocators are interchangeable exactly when they share a pool
+        template <typename U> [[nodiscard]] bool operator==(const PoolAllocator<U>& other) const noexcept
+        {
+            return pool_ == other.pool_;
+        }
+
+    private:
+        std::shared_ptr<detail::NodePool> pool_;
+    };
+} // namespace zinc
+
+#endif
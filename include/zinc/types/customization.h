@@ -19,6 +19,8 @@
 #ifndef ZINC_TYPES_CUSTOMIZATION
 #define ZINC_TYPES_CUSTOMIZATION
 
+#include <type_traits>
+
 namespace zinc
 {
     /// Customization point to enable use of custom Char types, used in various
@@ -28,6 +30,18 @@ namespace zinc
     {
         constexpr static bool value = false;
     };
+
+    /// Customization point marking a type safe to *relocate*: copying the
+    /// object representation into raw memory and then abandoning (not
+    /// destroying) the source must be equivalent to move-construct plus
+    /// destroy. Trivially copyable types qualify automatically; user types
+    /// whose moves don't observe their own address - which is nearly all of
+    /// them, self-referential types being the exception - can specialize this
+    /// to `true` and get the `memcpy` path through container growth
+    template <typename T> struct TriviallyRelocatable
+    {
+        constexpr static bool value = std::is_trivially_copyable_v<T>;
+    };
 } // namespace zinc
 
 #endif
\ No newline at end of file
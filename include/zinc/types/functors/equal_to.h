@@ -32,15 +32,12 @@ namespace zinc
         template <typename CharT> struct StringEq
         {
             using StringView = std::basic_string_view<CharT>;
-            using StringRef = const std::basic_string<CharT>&;
 
-            constexpr bool operator()(StringView lhs, StringView rhs) const noexcept { return lhs == rhs; }
-
-            constexpr bool operator()(StringRef lhs, StringRef rhs) const noexcept { return lhs == rhs; }
+            using is_transparent = void;
 
-            constexpr bool operator()(StringView lhs, StringRef rhs) const noexcept { return lhs == rhs; }
-
-            constexpr bool operator()(StringRef lhs, StringView rhs) const noexcept { return lhs == rhs; }
+            // a single view/view overload keeps calls with mixed argument types
+            // (string vs. view vs. literal) from ever being ambiguous
+            constexpr bool operator()(StringView lhs, StringView rhs) const noexcept { return lhs == rhs; }
         };
     } // namespace detail
 
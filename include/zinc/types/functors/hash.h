@@ -20,10 +20,18 @@
 #define ZINC_TYPES_FUNCTORS_HASH
 
 #include "zinc/types/concepts.h"
+#include "zinc/types/strings.h"
 #include <concepts>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <string_view>
 #include <utility>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 namespace zinc
 {
     template <typename T>
@@ -63,6 +71,165 @@ namespace zinc
         return val;
     }
 
+    namespace detail
+    {
+        constexpr inline std::uint64_t wyhash_secret[4] = {0xa0761d6478bd642full,
+            0xe7037ed1a0b428dbull,
+            0x8ebc6af09c88c6e3ull,
+            0x589965cc75374cc3ull};
+
+        [[nodiscard]] inline std::uint64_t hash_read64(const unsigned char* data) noexcept
+        {
+            std::uint64_t word;
+
+            std::memcpy(&word, data, sizeof(word));
+
+            return word;
+        }
+
+        [[nodiscard]] inline std::uint64_t hash_read32(const unsigned char* data) noexcept
+        {
+            std::uint32_t word;
+
+            std::memcpy(&word, data, sizeof(word));
+
+            return word;
+        }
+
+        /// The wyhash mixer: a full 64x64 -> 128 multiply folded back down by
+        /// XORing the halves, so every input bit influences every output bit
+        [[nodiscard]] inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b) noexcept
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            // MSVC has no __int128, but it has the one instruction this is
+            std::uint64_t high;
+            const auto low = _umul128(a, b, &high);
+
+            return low ^ high;
+#elif defined(__SIZEOF_INT128__)
+            __extension__ using Uint128 = unsigned __int128;
+
+            const auto product = static_cast<Uint128>(a) * static_cast<Uint128>(b);
+
+            return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64U);
+#else
+            // schoolbook 32x32 multiplies for targets with neither: same
+            // 128-bit product, four mulls and some carries instead of one mulx
+            const auto mask = std::uint64_t{0xFFFF'FFFF};
+            const auto ll = (a & mask) * (b & mask);
+            const auto lh = (a & mask) * (b >> 32U);
+            const auto hl = (a >> 32U) * (b & mask);
+            const auto hh = (a >> 32U) * (b >> 32U);
+
+            const auto mid = (ll >> 32U) + (lh & mask) + (hl & mask);
+            const auto low = (mid << 32U) | (ll & mask);
+            const auto high = hh + (lh >> 32U) + (hl >> 32U) + (mid >> 32U);
+
+            return low ^ high;
+#endif
+        }
+    } // namespace detail
+
+    /// Hashes a run of raw bytes with a wyhash-style word-at-a-time hash: 48
+    /// bytes per step through the bulk of the input, on unaligned 64-bit loads
+    /// and multiply-mix rounds instead of the byte-at-a-time loop `std::hash`
+    /// does for strings. This is what zinc's own string hashing is built on,
+    /// and it's the right building block for `Hash` specializations over any
+    /// other contiguous-byte keys.
+    ///
+    /// The result is stable within a process, but *not* across processes or
+    /// library versions - don't persist it.
+    ///
+    /// # Parameters
+    /// - `input`: The first byte to hash
+    /// - `length`: The number of bytes to hash
+    ///
+    /// # Returns
+    /// A hash of those `length` bytes
+    [[nodiscard]] inline std::size_t hash_bytes(const void* input, std::size_t length) noexcept
+    {
+        const auto* data = static_cast<const unsigned char*>(input);
+        auto seed = detail::wyhash_secret[0];
+        auto a = std::uint64_t{0};
+        auto b = std::uint64_t{0};
+
+        if (length <= 16)
+        {
+            if (length >= 4)
+            {
+                // two (possibly overlapping) reads off each end cover 4..16 bytes
+                a = (detail::hash_read32(data) << 32U) | detail::hash_read32(data + ((length >> 3U) << 2U));
+                b = (detail::hash_read32(data + length - 4) << 32U)
+                    | detail::hash_read32(data + length - 4 - ((length >> 3U) << 2U));
+            }
+            else if (length > 0)
+            {
+                a = (std::uint64_t{data[0]} << 16U) | (std::uint64_t{data[length >> 1U]} << 8U)
+                    | std::uint64_t{data[length - 1]};
+            }
+        }
+        else
+        {
+            auto remaining = length;
+
+            if (remaining > 48)
+            {
+                auto seed1 = seed;
+                auto seed2 = seed;
+
+                // three independent mix lanes keep the multiplies pipelined
+                do
+                {
+                    seed = detail::hash_mix(detail::hash_read64(data) ^ detail::wyhash_secret[1],
+                        detail::hash_read64(data + 8) ^ seed);
+                    seed1 = detail::hash_mix(detail::hash_read64(data + 16) ^ detail::wyhash_secret[2],
+                        detail::hash_read64(data + 24) ^ seed1);
+                    seed2 = detail::hash_mix(detail::hash_read64(data + 32) ^ detail::wyhash_secret[3],
+                        detail::hash_read64(data + 40) ^ seed2);
+
+                    data += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+
+                seed ^= seed1 ^ seed2;
+            }
+
+            while (remaining > 16)
+            {
+                seed = detail::hash_mix(detail::hash_read64(data) ^ detail::wyhash_secret[1],
+                    detail::hash_read64(data + 8) ^ seed);
+
+                data += 16;
+                remaining -= 16;
+            }
+
+            // the last 16 bytes, re-reading earlier bytes if fewer remain
+            a = detail::hash_read64(data + remaining - 16);
+            b = detail::hash_read64(data + remaining - 8);
+        }
+
+        return static_cast<std::size_t>(detail::hash_mix(a ^ detail::wyhash_secret[0] ^ length,
+            b ^ detail::wyhash_secret[1] ^ seed));
+    }
+
+    namespace detail
+    {
+        /// Hashes anything convertible to a `basic_string_view<CharT>` through
+        /// `hash_bytes` over the view's characters, so string keys can be
+        /// probed with views or C strings without ever materializing a
+        /// temporary `std::string` - and without libstdc++'s byte-at-a-time
+        /// string hash
+        template <Charlike CharT> struct TransparentStringHash
+        {
+            using is_transparent = void;
+
+            [[nodiscard]] std::size_t operator()(std::basic_string_view<CharT> view) const noexcept
+            {
+                return hash_bytes(view.data(), view.size() * sizeof(CharT));
+            }
+        };
+    } // namespace detail
+
     /// Zinc wrapper around `std::hash`. Used to provide a few utilities for implementing
     /// hashes on non-`std` types, but still build on `std::hash` and any specializations of it.
     template <typename T> struct Hash : std::hash<T>
@@ -70,6 +237,43 @@ namespace zinc
         // implement some magic in here
     };
 
+    /// Specialization for `std::basic_string` and `std::basic_string_view` types that
+    /// enables heterogeneous (and allocation-free) string hashing, mirroring what
+    /// `zinc::EqualTo` does for string equality
+    template <StringOrStringViewSpecialization T> struct Hash<T> : detail::TransparentStringHash<ValueT<T>>
+    {};
+
+    namespace detail
+    {
+        /// A multiply-xorshift finalizer (MurmurHash3's), turning a 64-bit
+        /// value into a 64-bit hash where every input bit affects every output
+        /// bit. Both constants are odd, so this is a bijection: distinct
+        /// integers still never collide, they just stop clustering
+        [[nodiscard]] constexpr std::uint64_t mix_integer(std::uint64_t value) noexcept
+        {
+            value ^= value >> 33U;
+            value *= 0xff51afd7ed558ccdull;
+            value ^= value >> 33U;
+            value *= 0xc4ceb9fe1a85ec53ull;
+            value ^= value >> 33U;
+
+            return value;
+        }
+    } // namespace detail
+
+    /// Specialization for the built-in integer types. `std::hash` is the
+    /// identity function on them for the implementations we care about, which
+    /// turns sequential IDs into one giant collision cluster the moment a
+    /// table masks the hash down to a slot index - so integers get a real
+    /// mixer instead of the `std::hash` passthrough
+    template <std::integral T> struct Hash<T>
+    {
+        [[nodiscard]] constexpr std::size_t operator()(T value) const noexcept
+        {
+            return static_cast<std::size_t>(detail::mix_integer(static_cast<std::uint64_t>(value)));
+        }
+    };
+
     /// Checks that a type is a valid `Cpp17Hash`. See https://timsong-cpp.github.io/cppwp/n4861/hash.requirements
     /// for the specifics, this checks what it can
     template <typename Hash, typename T> // clang-format off
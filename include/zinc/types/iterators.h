@@ -19,7 +19,9 @@
 #ifndef ZINC_TYPES_ITERATORS
 #define ZINC_TYPES_ITERATORS
 
+#include "zinc/types/iterators/chunks.h"
 #include "zinc/types/iterators/enumerate.h"
 #include "zinc/types/iterators/range.h"
+#include "zinc/types/iterators/zip.h"
 
 #endif
@@ -0,0 +1,173 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_TYPES_ITERATORS_CHUNKS
+#define ZINC_TYPES_ITERATORS_CHUNKS
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace zinc
+{
+    namespace detail
+    {
+        template <typename T, std::size_t N> struct ChunkingIterator
+        {
+            using iterator_category = std::bidirectional_iterator_tag;
+
+            using difference_type = std::ptrdiff_t;
+
+            T* current;
+
+            [[nodiscard]] bool operator==(const ChunkingIterator<T, N>& other) const noexcept = default;
+
+            [[nodiscard]] std::span<T, N> operator*() const noexcept { return std::span<T, N>(current, N); }
+
+            ChunkingIterator<T, N> operator++(int) noexcept
+            {
+                const auto copy = ChunkingIterator<T, N>{current};
+
+                current += N;
+
+                return copy;
+            }
+
+            ChunkingIterator<T, N>& operator++() noexcept
+            {
+                current += N;
+
+                return *this;
+            }
+
+            ChunkingIterator<T, N> operator--(int) noexcept
+            {
+                const auto copy = ChunkingIterator<T, N>{current};
+
+                current -= N;
+
+                return copy;
+            }
+
+            ChunkingIterator<T, N>& operator--() noexcept
+            {
+                current -= N;
+
+                return *this;
+            }
+        };
+    } // namespace detail
+
+    /// Adapts a contiguous range into a range of fixed-size `std::span<T, N>`
+    /// blocks, with whatever doesn't fill a final block exposed separately
+    /// through `remainder()`. The fixed extent is the entire point: the body
+    /// of a loop over the blocks has a constant trip count the compiler can
+    /// unroll and vectorize, with the prologue/epilogue split handled here
+    /// instead of by hand at every call site.
+    ///
+    /// Allows code like:
+    /// ```cpp
+    /// auto blocks = chunks_of<8>(values);
+    ///
+    /// for (auto block : blocks) {
+    ///     // `block` is a `std::span<const float, 8>`
+    /// }
+    ///
+    /// for (auto value : blocks.remainder()) {
+    ///     // the last `values.size() % 8` elements
+    /// }
+    /// ```
+    template <std::size_t N, std::ranges::contiguous_range T> class ChunksAdapter
+    {
+        static_assert(N > 0, "a chunk must hold at least one element");
+
+    public:
+        using Element = std::remove_reference_t<std::ranges::range_reference_t<T>>;
+
+        ChunksAdapter() noexcept = delete;
+
+        explicit ChunksAdapter(T& iterable) noexcept
+            : data_(std::ranges::data(iterable))
+            , size_(std::ranges::size(iterable))
+        {}
+
+        ChunksAdapter(const ChunksAdapter&) noexcept = default;
+
+        ChunksAdapter(ChunksAdapter&&) noexcept = default;
+
+        ChunksAdapter& operator=(const ChunksAdapter&) noexcept = default;
+
+        ChunksAdapter& operator=(ChunksAdapter&&) noexcept = default;
+
+        ~ChunksAdapter() noexcept = default;
+
+        [[nodiscard]] auto begin() const noexcept { return detail::ChunkingIterator<Element, N>{data_}; }
+
+        [[nodiscard]] auto end() const noexcept
+        {
+            return detail::ChunkingIterator<Element, N>{data_ + (size_ - remainder_size())};
+        }
+
+        /// The elements left over after the last full block, as a span of
+        /// dynamic extent holding fewer than `N` elements (possibly zero).
+        [[nodiscard]] std::span<Element> remainder() const noexcept
+        {
+            return std::span<Element>(data_ + (size_ - remainder_size()), remainder_size());
+        }
+
+        /// The number of full `N`-element blocks iteration will yield
+        [[nodiscard]] std::size_t block_count() const noexcept { return size_ / N; }
+
+    private:
+        [[nodiscard]] std::size_t remainder_size() const noexcept { return size_ % N; }
+
+        Element* data_;
+        std::size_t size_;
+    };
+
+    /// Breaks a contiguous range into `const` blocks of exactly `N` elements,
+    /// plus a sub-`N` remainder reachable through `remainder()` on the
+    /// returned adapter.
+    ///
+    /// # Parameters
+    /// - `iterable`: The contiguous range being iterated over in blocks
+    ///
+    /// # Returns
+    /// A `ChunksAdapter` yielding `std::span<const T, N>` blocks
+    template <std::size_t N, std::ranges::contiguous_range T> [[nodiscard]] constexpr auto chunks_of(const T& iterable)
+    {
+        return ChunksAdapter<N, const T>(iterable);
+    }
+
+    /// Breaks a contiguous range into **mutable** blocks of exactly `N`
+    /// elements, plus a sub-`N` remainder reachable through `remainder()` on
+    /// the returned adapter.
+    ///
+    /// # Parameters
+    /// - `iterable`: The contiguous range being iterated over in blocks
+    ///
+    /// # Returns
+    /// A `ChunksAdapter` yielding `std::span<T, N>` blocks
+    template <std::size_t N, std::ranges::contiguous_range T> [[nodiscard]] constexpr auto chunks_of_mut(T& iterable)
+    {
+        return ChunksAdapter<N, T>(iterable);
+    }
+} // namespace zinc
+
+#endif
@@ -19,6 +19,7 @@
 #ifndef ZINC_TYPES_ITERATORS_RANGE
 #define ZINC_TYPES_ITERATORS_RANGE
 
+#include "zinc/types/aliases.h"
 #include <concepts>
 #include <cstddef>
 #include <iterator>
@@ -0,0 +1,173 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_TYPES_ITERATORS_ZIP
+#define ZINC_TYPES_ITERATORS_ZIP
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
+
+namespace zinc
+{
+    namespace detail
+    {
+        /// The "end" of a zipped range: one sentinel per zipped-over range.
+        /// A `ZippingIterator` compares equal to it as soon as *any* of its
+        /// iterators hits the matching sentinel, which is what makes zipping
+        /// over ranges of different lengths stop at the shortest one.
+        template <typename... Ss> struct ZipSentinel
+        {
+            std::tuple<Ss...> ends;
+        };
+
+        template <std::forward_iterator... Is> struct ZippingIterator
+        {
+            using iterator_concept = std::forward_iterator_tag;
+
+            // yes, a tuple of references: C++20's `indirectly_readable` has no
+            // common-reference machinery for tuples (that's a C++23 addition,
+            // the same one that made `views::zip` possible), so the usual
+            // tuple-of-values `value_type` would disqualify this iterator from
+            // `forward_iterator` and with it from composing with `enumerate`
+            using value_type = std::tuple<std::iter_reference_t<Is>...>;
+
+            using difference_type = std::ptrdiff_t;
+
+            std::tuple<Is...> iters;
+
+            [[nodiscard]] bool operator==(const ZippingIterator<Is...>& other) const noexcept = default;
+
+            template <typename... Ss> [[nodiscard]] bool operator==(const ZipSentinel<Ss...>& other) const noexcept
+            {
+                return [&]<std::size_t... Ns>(std::index_sequence<Ns...>) {
+                    return ((std::get<Ns>(iters) == std::get<Ns>(other.ends)) || ...);
+                }(std::index_sequence_for<Is...>{});
+            }
+
+            [[nodiscard]] std::tuple<std::iter_reference_t<Is>...> operator*() const noexcept
+            {
+                return std::apply(
+                    [](auto&... its) {
+                        return std::tuple<std::iter_reference_t<Is>...>(*its...);
+                    },
+                    iters);
+            }
+
+            ZippingIterator<Is...> operator++(int) noexcept(noexcept(++*this))
+            {
+                const auto copy = ZippingIterator<Is...>{iters};
+
+                ++*this;
+
+                return copy;
+            }
+
+            ZippingIterator<Is...>& operator++() noexcept((noexcept(++std::declval<Is&>()) && ...))
+            {
+                std::apply([](auto&... its) { (++its, ...); }, iters);
+
+                return *this;
+            }
+        };
+    } // namespace detail
+
+    /// Adapts several ranges into one range of tuples, advancing an iterator
+    /// into each of them in lockstep and stopping at the end of the shortest.
+    /// Similar to `iter.zip(...)` in Rust, built to compose with `enumerate`
+    /// and friends.
+    ///
+    /// Allows code like:
+    /// ```cpp
+    /// for (auto [x, y] : zip(xs, ys)) {
+    ///     std::cout << x << " * " << y << '\n';
+    /// }
+    /// ```
+    template <std::ranges::range... Ts> class ZipAdapter
+    {
+    public:
+        ZipAdapter() noexcept = delete;
+
+        explicit ZipAdapter(Ts&... iterables) noexcept
+            : iterables_(iterables...)
+        {}
+
+        ZipAdapter(const ZipAdapter&) noexcept = default;
+
+        ZipAdapter(ZipAdapter&&) noexcept = default;
+
+        ZipAdapter& operator=(const ZipAdapter&) noexcept = default;
+
+        ZipAdapter& operator=(ZipAdapter&&) noexcept = default;
+
+        ~ZipAdapter() noexcept = default;
+
+        [[nodiscard]] auto begin() const noexcept
+        {
+            return std::apply(
+                [](auto&... its) {
+                    return detail::ZippingIterator<decltype(std::ranges::begin(its))...>{{std::ranges::begin(its)...}};
+                },
+                iterables_);
+        }
+
+        [[nodiscard]] auto end() const noexcept
+        {
+            return std::apply(
+                [](auto&... its) {
+                    return detail::ZipSentinel<decltype(std::ranges::end(its))...>{{std::ranges::end(its)...}};
+                },
+                iterables_);
+        }
+
+    private:
+        std::tuple<Ts&...> iterables_;
+    };
+
+    /// Zips any number of ranges into one range of tuples of `const`
+    /// references, iterated in parallel without any index arithmetic.
+    /// Iteration stops at the end of the shortest range.
+    ///
+    /// # Parameters
+    /// - `iterables`: The ranges to iterate over in lockstep
+    ///
+    /// # Returns
+    /// A `ZipAdapter` that returns `const` objects
+    template <std::ranges::range... Ts> [[nodiscard]] constexpr auto zip(const Ts&... iterables)
+    {
+        return ZipAdapter<const Ts...>(iterables...);
+    }
+
+    /// Zips any number of **mutable** ranges into one range of tuples of
+    /// references, iterated in parallel without any index arithmetic.
+    /// Iteration stops at the end of the shortest range.
+    ///
+    /// # Parameters
+    /// - `iterables`: The ranges to iterate over in lockstep
+    ///
+    /// # Returns
+    /// A `ZipAdapter` that returns non-`const` objects
+    template <std::ranges::range... Ts> [[nodiscard]] constexpr auto zip_mut(Ts&... iterables)
+    {
+        return ZipAdapter<Ts...>(iterables...);
+    }
+} // namespace zinc
+
+#endif
@@ -20,16 +20,103 @@
 #define ZINC_TYPES_STORAGE
 
 #include "zinc/types/concepts.h"
+#include "zinc/types/pointers.h"
 #include <cstddef>
+#include <utility>
 
 namespace zinc
 {
+    /// The size of one line of destructive interference: two objects at
+    /// least this far apart never false-share. Not the standard's
+    /// `hardware_destructive_interference_size` - that one varies with
+    /// compiler flags, which is an ABI break waiting in any header (gcc
+    /// warns about exactly this), so this is the fixed 64 that it resolves
+    /// to on every target the library cares about
+    constexpr inline std::size_t cache_line_size = 64;
+
     /// Slightly better `std::aligned_storage_t`, guaranteed to be exactly enough space
     /// for an aligned `T` and no more.
     template <typename T> struct StorageFor
     {
-        alignas(T) std::byte storage[sizeof(std::byte)];
+        alignas(T) std::byte storage[sizeof(T)];
+
+        /// Views the storage as the `T` it's shaped for (which had better
+        /// have been constructed in it)
+        [[nodiscard]] T* as() noexcept { return pointer_cast<T*>(storage); }
+
+        /// Views the storage as the `T` it's shaped for, immutably
+        [[nodiscard]] const T* as() const noexcept { return pointer_cast<const T*>(storage); }
+    };
+
+    /// A `T` with a cache line to itself: aligned to the line, and padded
+    /// out to a whole number of lines by that alignment, so two
+    /// `CacheAligned` objects - say, neighbors in a per-thread counter
+    /// array - never false-share
+    template <typename T> struct CacheAligned
+    {
+        constexpr CacheAligned() = default;
+
+        /// Builds the wrapped value in place from `args`
+        ///
+        /// # Parameters
+        /// - `args`: The arguments the value is constructed from
+        template <typename... Args>
+        constexpr explicit CacheAligned(Args&&... args)
+            : value(std::forward<Args>(args)...)
+        {}
+
+        alignas(cache_line_size) T value;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        constexpr inline std::size_t line_padding_after = (cache_line_size - sizeof(T) % cache_line_size) % cache_line_size;
+
+        template <typename T, std::size_t Padding> struct PaddedLayout
+        {
+            constexpr PaddedLayout() = default;
+
+            template <typename... Args>
+            constexpr explicit PaddedLayout(Args&&... args)
+                : value(std::forward<Args>(args)...)
+            {}
+
+            T value;
+            std::byte padding[Padding];
+        };
+
+        template <typename T> struct PaddedLayout<T, 0>
+        {
+            constexpr PaddedLayout() = default;
+
+            template <typename... Args>
+            constexpr explicit PaddedLayout(Args&&... args)
+                : value(std::forward<Args>(args)...)
+            {}
+
+            T value;
+        };
+    } // namespace detail
+
+    /// A `T` padded out to a whole number of cache lines *without* raising
+    /// its alignment: the size keeps array neighbors a line apart, but the
+    /// type works anywhere a plain `T` does (over-aligned allocation
+    /// included in "anywhere", since it doesn't need one). When the whole
+    /// array can be line-aligned, `CacheAligned` is the stronger guarantee.
+    template <typename T> struct Padded : detail::PaddedLayout<T, detail::line_padding_after<T>>
+    {
+        constexpr Padded() = default;
+
+        /// Builds the wrapped value in place from `args`
+        ///
+        /// # Parameters
+        /// - `args`: The arguments the value is constructed from
+        template <typename... Args>
+        constexpr explicit Padded(Args&&... args)
+            : detail::PaddedLayout<T, detail::line_padding_after<T>>(std::forward<Args>(args)...)
+        {}
     };
 } // namespace zinc
 
-#endif
\ No newline at end of file
+#endif
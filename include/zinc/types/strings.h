@@ -88,7 +88,7 @@ namespace zinc
     template <typename T> concept StringSpecialization = detail::IsStringSpecialization<T>::value;
 
     /// Checks if a type is some specialization of `std::basic_string_view` with any `CharT`
-    template <typename T> concept StringViewSpecialization = detail::IsStringSpecialization<T>::value;
+    template <typename T> concept StringViewSpecialization = detail::IsStringViewSpecialization<T>::value;
 
     /// Checks if a type is a specialization of either `std::basic_string` or `std::basic_string_view`
     template <typename T>
@@ -21,11 +21,14 @@
 
 #include "zinc/types/aliases.h"
 #include "zinc/types/allocators.h"
+#include "zinc/types/allocators/arena.h"
+#include "zinc/types/allocators/pool.h"
 #include "zinc/types/concepts.h"
 #include "zinc/types/customization.h"
 #include "zinc/types/functors.h"
 #include "zinc/types/iterators.h"
 #include "zinc/types/pointers.h"
+#include "zinc/types/storage.h"
 #include "zinc/types/strings.h"
 
 #endif
\ No newline at end of file
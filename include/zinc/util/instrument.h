@@ -0,0 +1,292 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#ifndef ZINC_UTIL_INSTRUMENT
+#define ZINC_UTIL_INSTRUMENT
+
+#include "zinc/io/console.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+// First-party hot-path instrumentation, in the same spirit as `defer`:
+// `ZINC_SCOPE_TIMER("name")` drops an RAII object into the current scope that
+// charges the scope's wall time to a named, process-wide aggregate, and
+// `ZINC_COUNTER_ADD("name", n)` bumps a named counter. Both compile to
+// nothing unless `ZINC_INSTRUMENT` is defined, so the hooks can stay in
+// shipping code and be turned on with a recompile instead of attaching an
+// external profiler.
+//
+// The hot path is built to disappear into the noise: timestamps come from the
+// TSC where there is one, and every site hands each thread its own cell, so
+// recording a sample is two timestamp reads and two uncontended relaxed
+// stores - the same discipline the `ZINC_TABLE_STATS` counters follow. The
+// cells and site records live for the rest of the process by design; the
+// total is bounded by (sites x threads) and a registry that can lose samples
+// to cleanup isn't worth trusting.
+
+#ifdef ZINC_INSTRUMENT
+
+namespace zinc
+{
+    namespace detail
+    {
+        /// Reads a cheap, monotonic timestamp in unspecified ticks. The TSC on
+        /// x86 and the generic counter on AArch64; the steady clock everywhere
+        /// else. Tick rates differ across machines, so dumps report ticks and
+        /// ratios rather than pretending to know nanoseconds.
+        inline std::uint64_t read_timestamp() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+            std::uint64_t ticks;
+
+            asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+
+            return ticks;
+#else
+            return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        /// One thread's share of one timer site. Only the owning thread ever
+        /// writes it, so the writes are plain relaxed stores; the atomics exist
+        /// so a dump on another thread reads torn-free values.
+        struct TimerCell
+        {
+            std::atomic<std::uint64_t> calls = 0;
+
+            std::atomic<std::uint64_t> ticks = 0;
+
+            TimerCell* next = nullptr;
+        };
+
+        /// One thread's share of one counter site, same ownership rules as
+        /// `TimerCell`.
+        struct CounterCell
+        {
+            std::atomic<std::uint64_t> value = 0;
+
+            CounterCell* next = nullptr;
+        };
+
+        /// Pushes `node` onto the intrusive list headed by `head`. Lock-free,
+        /// and only ever runs on cold paths (site registration, a thread's
+        /// first visit to a site).
+        template <typename T> void push_onto_list(std::atomic<T*>& head, T* node) noexcept
+        {
+            auto* expected = head.load(std::memory_order_relaxed);
+
+            do
+            {
+                node->next = expected;
+            } while (!head.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /// A single `ZINC_SCOPE_TIMER` call site. Created exactly once as a
+        /// function-local static, registers itself with the process-wide list
+        /// on construction, and hands each thread a private cell to record
+        /// into.
+        struct TimerSite
+        {
+            explicit TimerSite(const char* site_name) noexcept;
+
+            /// Allocates this thread's cell for the site. Called once per
+            /// (site, thread) pair from behind a `thread_local`; the cell is
+            /// never freed.
+            [[nodiscard]] TimerCell& cell_for_thread()
+            {
+                auto* cell = new TimerCell();
+
+                push_onto_list(cells, cell);
+
+                return *cell;
+            }
+
+            const char* name;
+
+            std::atomic<TimerCell*> cells = nullptr;
+
+            TimerSite* next = nullptr;
+        };
+
+        /// A single `ZINC_COUNTER_ADD` call site, structured exactly like
+        /// `TimerSite`.
+        struct CounterSite
+        {
+            explicit CounterSite(const char* site_name) noexcept;
+
+            [[nodiscard]] CounterCell& cell_for_thread()
+            {
+                auto* cell = new CounterCell();
+
+                push_onto_list(cells, cell);
+
+                return *cell;
+            }
+
+            const char* name;
+
+            std::atomic<CounterCell*> cells = nullptr;
+
+            CounterSite* next = nullptr;
+        };
+
+        /// The process-wide registries: intrusive lists of every site the
+        /// program has executed at least once. Sites are static-lifetime and
+        /// never unregister.
+        inline constinit std::atomic<TimerSite*> timer_sites = nullptr;
+
+        inline constinit std::atomic<CounterSite*> counter_sites = nullptr;
+
+        inline TimerSite::TimerSite(const char* site_name) noexcept
+            : name(site_name)
+        {
+            push_onto_list(timer_sites, this);
+        }
+
+        inline CounterSite::CounterSite(const char* site_name) noexcept
+            : name(site_name)
+        {
+            push_onto_list(counter_sites, this);
+        }
+
+        /// The RAII half of `ZINC_SCOPE_TIMER`: stamps the clock on
+        /// construction and charges the elapsed ticks to the thread's cell on
+        /// destruction. Plain load/store instead of `fetch_add` because the
+        /// cell has exactly one writer.
+        class ScopeTimer
+        {
+        public:
+            explicit ScopeTimer(TimerCell& cell) noexcept
+                : cell_(cell)
+                , start_(read_timestamp())
+            {}
+
+            ScopeTimer(const ScopeTimer&) = delete;
+
+            ScopeTimer(ScopeTimer&&) = delete;
+
+            ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+            ScopeTimer& operator=(ScopeTimer&&) = delete;
+
+            ~ScopeTimer()
+            {
+                const auto elapsed = read_timestamp() - start_;
+
+                cell_.calls.store(cell_.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                cell_.ticks.store(cell_.ticks.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+            }
+
+        private:
+            TimerCell& cell_;
+
+            std::uint64_t start_;
+        };
+    } // namespace detail
+
+    /// Writes every timer and counter aggregate the process has recorded so
+    /// far to `out`, one line per site, through the io layer's `sprint`.
+    /// Timers report total calls, total ticks and ticks-per-call; counters
+    /// report their sum across threads. Safe to call while other threads are
+    /// still recording - it reads a consistent-enough snapshot, not a frozen
+    /// one.
+    ///
+    /// # Parameters
+    /// - `out`: The stream to dump the aggregates to
+    inline void dump_instrumentation(std::ostream& out)
+    {
+        for (auto* site = detail::timer_sites.load(std::memory_order_acquire); site != nullptr; site = site->next)
+        {
+            auto calls = std::uint64_t{0};
+            auto ticks = std::uint64_t{0};
+
+            for (auto* cell = site->cells.load(std::memory_order_acquire); cell != nullptr; cell = cell->next)
+            {
+                calls += cell->calls.load(std::memory_order_relaxed);
+                ticks += cell->ticks.load(std::memory_order_relaxed);
+            }
+
+            const auto per_call = (calls == 0) ? std::uint64_t{0} : ticks / calls;
+
+            zinc::sprint(out, "timer ", site->name, ": ", calls, " calls, ", ticks, " ticks, ", per_call,
+                " ticks/call\n");
+        }
+
+        for (auto* site = detail::counter_sites.load(std::memory_order_acquire); site != nullptr; site = site->next)
+        {
+            auto value = std::uint64_t{0};
+
+            for (auto* cell = site->cells.load(std::memory_order_acquire); cell != nullptr; cell = cell->next)
+            {
+                value += cell->value.load(std::memory_order_relaxed);
+            }
+
+            zinc::sprint(out, "counter ", site->name, ": ", value, "\n");
+        }
+    }
+} // namespace zinc
+
+#define ZINC_DETAIL_INSTRUMENT_CONCAT2(lhs, rhs) lhs##rhs
+#define ZINC_DETAIL_INSTRUMENT_CONCAT(lhs, rhs) ZINC_DETAIL_INSTRUMENT_CONCAT2(lhs, rhs)
+
+/// Charges the rest of the current scope's wall time to the named aggregate.
+/// `name` must be a string literal (the registry keeps the pointer, it never
+/// copies). Costs two timestamp reads and two uncontended relaxed stores when
+/// `ZINC_INSTRUMENT` is defined, and nothing at all otherwise.
+#define ZINC_SCOPE_TIMER(name)                                                                                         \
+    static ::zinc::detail::TimerSite ZINC_DETAIL_INSTRUMENT_CONCAT(zinc_timer_site_, __LINE__){name};                  \
+    thread_local ::zinc::detail::TimerCell& ZINC_DETAIL_INSTRUMENT_CONCAT(zinc_timer_cell_, __LINE__) =                \
+        ZINC_DETAIL_INSTRUMENT_CONCAT(zinc_timer_site_, __LINE__).cell_for_thread();                                   \
+    const ::zinc::detail::ScopeTimer ZINC_DETAIL_INSTRUMENT_CONCAT(zinc_timer_scope_, __LINE__)                        \
+    {                                                                                                                  \
+        ZINC_DETAIL_INSTRUMENT_CONCAT(zinc_timer_cell_, __LINE__)                                                      \
+    }
+
+/// Adds `amount` to the named counter on the calling thread's private cell;
+/// `dump_instrumentation` sums the cells. Same literal-lifetime rule and same
+/// compile-to-nothing behavior as `ZINC_SCOPE_TIMER`.
+#define ZINC_COUNTER_ADD(name, amount)                                                                                 \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static ::zinc::detail::CounterSite zinc_counter_site_{name};                                                   \
+        thread_local ::zinc::detail::CounterCell& zinc_counter_cell_ = zinc_counter_site_.cell_for_thread();           \
+                                                                                                                       \
+        zinc_counter_cell_.value.store(                                                                                \
+            zinc_counter_cell_.value.load(std::memory_order_relaxed) + (amount), std::memory_order_relaxed);           \
+    } while (false)
+
+#else // ZINC_INSTRUMENT
+
+namespace zinc
+{
+    /// The disabled build's stand-in: same signature, writes nothing, so call
+    /// sites compile identically whether instrumentation is on or off.
+    inline void dump_instrumentation(std::ostream&) {}
+} // namespace zinc
+
+#define ZINC_SCOPE_TIMER(name) static_cast<void>(0)
+
+#define ZINC_COUNTER_ADD(name, amount) static_cast<void>(0)
+
+#endif // ZINC_INSTRUMENT
+
+#endif
@@ -23,7 +23,9 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace zinc
 {
@@ -55,18 +57,30 @@ namespace zinc
     ///   - Is a `std::vector<U>`, where `U` is a type that fulfills `ArgumentType<U>`
     template <typename T> concept ArgumentType = Satisfies<T, detail::ValidArgType>;
 
+    /// One argument's description, built up fluent-style:
+    ///
+    /// ```cpp
+    /// constexpr auto arg = Arg<std::string>("opt")
+    ///     .short_name('o')
+    ///     .value_name("OPT-LEVEL")
+    ///     .flag(false)
+    ///     .description("The optimization level to use");
+    /// ```
+    ///
+    /// Everything is a `string_view` into whatever the caller handed over, so
+    /// an `Arg` (and a whole table of them) can live in `constexpr` data.
     template <ArgumentType T> class Arg
     {
     public:
         Arg() = delete;
 
-        Arg(std::string_view name)
+        constexpr Arg(std::string_view name)
             : name_(name)
         {}
 
         Arg(const Arg&) = delete;
 
-        Arg(Arg&&) noexcept = default;
+        constexpr Arg(Arg&&) noexcept = default;
 
         Arg& operator=(const Arg&) = delete;
 
@@ -74,34 +88,50 @@ namespace zinc
 
         ~Arg() = default;
 
-        Arg&& description(std::string_view help_message) noexcept
+        constexpr Arg&& description(std::string_view help_message) noexcept
         {
             help_ = help_message;
 
             return std::move(*this);
         }
 
-        Arg&& value_name(std::string_view value_name) noexcept
+        constexpr Arg&& value_name(std::string_view value_name) noexcept
         {
             value_ = value_name;
 
             return std::move(*this);
         }
 
-        Arg&& short_name(char short_name) noexcept
+        constexpr Arg&& short_name(char short_name) noexcept
         {
             short_ = short_name;
 
             return std::move(*this);
         }
 
-        Arg&& flag(bool state) noexcept
+        constexpr Arg&& flag(bool state) noexcept
         {
             flag_ = state;
 
             return std::move(*this);
         }
 
+        /// Gets the argument's long name, matched as `--{name}`
+        [[nodiscard]] constexpr std::string_view name() const noexcept { return name_; }
+
+        /// Checks whether the argument is an on/off toggle rather than one
+        /// that takes a value (only meaningful for `bool` arguments)
+        [[nodiscard]] constexpr bool is_flag() const noexcept { return flag_; }
+
+        /// Gets the argument's help text, if it was given any
+        [[nodiscard]] constexpr const std::optional<std::string_view>& help() const noexcept { return help_; }
+
+        /// Gets the placeholder shown for the argument's value, if it was given one
+        [[nodiscard]] constexpr const std::optional<std::string_view>& value_name() const noexcept { return value_; }
+
+        /// Gets the argument's short name, matched as `-{short}`, if it has one
+        [[nodiscard]] constexpr const std::optional<char>& short_name() const noexcept { return short_; }
+
     private:
         std::string_view name_;                                // -n, --{name}
         bool flag_ = true;                                     // whether or not the variable is just an on/off toggle
@@ -110,12 +140,6 @@ namespace zinc
         std::optional<char> short_ = std::nullopt;             // -{short}, --long
         std::optional<T> default_value_ = std::nullopt;        // a default value of some sort
     };
-
-    Arg arg = Arg<std::string>("opt")
-                  .short_name('o')
-                  .value_name("OPT-LEVEL")
-                  .flag(false)
-                  .description("The optimization level to use");
 } // namespace zinc
 
 #endif
\ No newline at end of file
@@ -21,33 +21,338 @@
 
 #include "zinc/types/concepts.h"
 #include "zinc/util/options/args.h"
+#include <charconv>
+#include <concepts>
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace zinc
 {
     namespace detail
     {
-        //
+        // what `parse()` actually stores per argument type: strings stay as
+        // views into argv, so parsing never copies them onto the heap
+        template <typename T> struct ParsedValueImpl
+        {
+            using type = T;
+        };
+
+        template <> struct ParsedValueImpl<std::string>
+        {
+            using type = std::string_view;
+        };
+
+        template <typename T> using ParsedValue = typename ParsedValueImpl<T>::type;
+
+        template <ArgumentType T> [[nodiscard]] bool parse_value(std::string_view token, std::optional<ParsedValue<T>>& out)
+        {
+            if constexpr (std::same_as<T, std::string>)
+            {
+                out = token;
+
+                return true;
+            }
+            else if constexpr (std::same_as<T, bool>)
+            {
+                if (token == "true" || token == "1")
+                {
+                    out = true;
+
+                    return true;
+                }
+
+                if (token == "false" || token == "0")
+                {
+                    out = false;
+
+                    return true;
+                }
+
+                return false;
+            }
+            else if constexpr (std::same_as<T, char>)
+            {
+                if (token.size() != 1)
+                {
+                    return false;
+                }
+
+                out = token[0];
+
+                return true;
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                auto value = T{};
+                const auto result = std::from_chars(token.data(), token.data() + token.size(), value);
+
+                if (result.ec != std::errc{} || result.ptr != token.data() + token.size())
+                {
+                    return false;
+                }
+
+                out = value;
+
+                return true;
+            }
+            else
+            {
+                static_assert(!std::same_as<T, T>,
+                    "vector-valued arguments need an allocating parse and aren't supported by OptParser");
+            }
+        }
     } // namespace detail
 
-    class OptParser
+    /// The ways a command line can fail to parse
+    enum class OptParseErrorKind
+    {
+        /// A `--name` or `-s` token that no argument in the table matches
+        unknown_option,
+        /// A value-taking option at the end of the command line, with nothing after it
+        missing_value,
+        /// A value that wouldn't parse as its argument's type
+        malformed_value,
+        /// A token that isn't an option at all
+        unexpected_positional,
+    };
+
+    /// Where and how a command line failed to parse
+    struct OptParseError
+    {
+        OptParseErrorKind kind;
+        std::string_view token;
+    };
+
+    /// What `OptParser::parse` found: one slot per argument in the table, in
+    /// the order they were added, each holding a value if the option showed
+    /// up on the command line. String-typed arguments come back as
+    /// `string_view`s into argv, so they're only valid as long as it is.
+    template <ArgumentType... Ts> class OptResults
+    {
+    public:
+        /// Gets the `I`th argument's parsed value, `std::nullopt` if its
+        /// option never appeared
+        template <std::size_t I> [[nodiscard]] const auto& get() const noexcept { return std::get<I>(values_); }
+
+        /// Checks whether the whole command line parsed cleanly
+        [[nodiscard]] bool ok() const noexcept { return !error_.has_value(); }
+
+        /// Gets what went wrong, if anything did. Parsing stops at the first
+        /// error, so slots after it are as they were.
+        [[nodiscard]] const std::optional<OptParseError>& error() const noexcept { return error_; }
+
+    private:
+        template <ArgumentType...> friend class OptParser;
+
+        std::tuple<std::optional<detail::ParsedValue<Ts>>...> values_;
+        std::optional<OptParseError> error_;
+    };
+
+    /// A command-line parser whose argument table is plain `constexpr` data:
+    ///
+    /// ```cpp
+    /// constexpr static auto parser = zinc::OptParser()
+    ///     .add_arg(zinc::Arg<bool>("verbose").short_name('v'))
+    ///     .add_arg(zinc::Arg<int>("jobs").short_name('j').flag(false));
+    ///
+    /// const auto results = parser.parse(argc, argv);
+    /// ```
+    ///
+    /// Each `add_arg` folds the argument's type into the parser's own, so
+    /// types are resolved at compile time and `parse(argc, argv)` is nothing
+    /// but `string_view` comparisons against the table - no `std::string`s,
+    /// no maps, no allocation at all. That's deliberate: for a tool invoked
+    /// thousands of times per CI run, argument parsing is startup cost.
+    ///
+    /// Options match as `--name`, `--name=value`, `--name value`, and
+    /// `-s` / `-s value` for short names. `bool` arguments are on/off flags
+    /// unless built with `.flag(false)`.
+    template <ArgumentType... Ts> class OptParser
     {
     public:
-        OptParser() = default;
+        constexpr OptParser() = default;
+
+        /// Adds an argument to the table, folding its type into the
+        /// parser's. Note the return type: each call produces a *new*
+        /// parser, which is what lets the whole table be `constexpr`.
+        ///
+        /// # Parameters
+        /// - `argument`: The argument to add
+        ///
+        /// # Returns
+        /// The parser with the argument appended to its table
+        template <ArgumentType T> [[nodiscard]] constexpr OptParser<Ts..., T> add_arg(Arg<T> argument) &&
+        {
+            return OptParser<Ts..., T>(std::tuple_cat(std::move(args_), std::make_tuple(std::move(argument))));
+        }
+
+        /// Parses a command line against the table, without allocating
+        ///
+        /// # Parameters
+        /// - `argc`: The argument count, as given to `main`
+        /// - `argv`: The argument vector, as given to `main` (the results
+        ///   borrow from it, so it must outlive them)
+        ///
+        /// # Returns
+        /// A slot per argument, plus the first error if one was hit
+        [[nodiscard]] OptResults<Ts...> parse(int argc, const char* const* argv) const
+        {
+            auto results = OptResults<Ts...>();
+
+            for (auto i = 1; i < argc && !results.error_.has_value(); ++i)
+            {
+                const auto token = std::string_view(argv[i]);
+                auto name = std::string_view();
+                auto inline_value = std::optional<std::string_view>();
+                auto is_short = false;
+
+                if (token.starts_with("--"))
+                {
+                    name = token.substr(2);
+
+                    if (const auto eq = name.find('='); eq != std::string_view::npos)
+                    {
+                        inline_value = name.substr(eq + 1);
+                        name = name.substr(0, eq);
+                    }
+                }
+                else if (token.size() == 2 && token[0] == '-' && token[1] != '-')
+                {
+                    name = token.substr(1);
+                    is_short = true;
+                }
+                else
+                {
+                    results.error_ = OptParseError{OptParseErrorKind::unexpected_positional, token};
+
+                    break;
+                }
+
+                const auto matched =
+                    try_each(std::index_sequence_for<Ts...>{}, results, name, is_short, inline_value, i, argc, argv);
+
+                if (!matched && !results.error_.has_value())
+                {
+                    results.error_ = OptParseError{OptParseErrorKind::unknown_option, token};
+                }
+            }
+
+            return results;
+        }
 
-        template <ArgumentType T> OptParser& add_arg(Arg<T> argument)
+        /// Builds a human-readable option summary from the table, one line
+        /// per argument. The one part of the parser that does allocate,
+        /// since it only runs on the `--help` path.
+        [[nodiscard]] std::string help() const
         {
-            (void)argument;
+            auto message = std::string("options:\n");
 
-            return *this;
+            std::apply(
+                [&message](const auto&... arguments) {
+                    (append_help_line(message, arguments), ...);
+                },
+                args_);
+
+            return message;
         }
 
     private:
-        std::optional<std::string> help_message_;
+        template <ArgumentType...> friend class OptParser;
+
+        constexpr explicit OptParser(std::tuple<Arg<Ts>...> args)
+            : args_(std::move(args))
+        {}
+
+        template <std::size_t... Is>
+        [[nodiscard]] bool try_each(std::index_sequence<Is...>, OptResults<Ts...>& results, std::string_view name,
+            bool is_short, std::optional<std::string_view> inline_value, int& i, int argc, const char* const* argv) const
+        {
+            return (try_match<Is>(results, name, is_short, inline_value, i, argc, argv) || ...);
+        }
+
+        template <std::size_t I>
+        [[nodiscard]] bool try_match(OptResults<Ts...>& results, std::string_view name, bool is_short,
+            std::optional<std::string_view> inline_value, int& i, int argc, const char* const* argv) const
+        {
+            using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+            const auto& argument = std::get<I>(args_);
+
+            if (is_short ? (argument.short_name() != name[0]) : (argument.name() != name))
+            {
+                return false;
+            }
+
+            if constexpr (std::same_as<T, bool>)
+            {
+                // flags are presence-only unless given an explicit `=value`
+                if (argument.is_flag() && !inline_value.has_value())
+                {
+                    std::get<I>(results.values_) = true;
+
+                    return true;
+                }
+            }
+
+            auto value = inline_value;
+
+            if (!value.has_value())
+            {
+                if (i + 1 >= argc)
+                {
+                    results.error_ = OptParseError{OptParseErrorKind::missing_value, name};
+
+                    return true;
+                }
+
+                value = std::string_view(argv[++i]);
+            }
+
+            if (!detail::parse_value<T>(*value, std::get<I>(results.values_)))
+            {
+                results.error_ = OptParseError{OptParseErrorKind::malformed_value, *value};
+            }
+
+            return true;
+        }
+
+        template <ArgumentType T> static void append_help_line(std::string& message, const Arg<T>& argument)
+        {
+            message += "  ";
+
+            if (argument.short_name().has_value())
+            {
+                message += '-';
+                message += *argument.short_name();
+                message += ", ";
+            }
+
+            message += "--";
+            message += argument.name();
+
+            if (argument.value_name().has_value())
+            {
+                message += " <";
+                message += *argument.value_name();
+                message += '>';
+            }
+
+            if (argument.help().has_value())
+            {
+                message += "\n      ";
+                message += *argument.help();
+            }
+
+            message += '\n';
+        }
+
+        std::tuple<Arg<Ts>...> args_;
     };
 } // namespace zinc
 
-#endif
\ No newline at end of file
+#endif
@@ -20,16 +20,93 @@
 #define ZINC_UTIL_UNINITIALIZED
 
 #include "zinc/types/allocators.h"
-#include <concepts>
+#include "zinc/types/customization.h"
 #include <cstddef>
-#include <memory>
-#include <ranges>
+#include <cstring>
+#include <utility>
 
 namespace zinc
 {
-    namespace ranges = std::ranges;
+    /// Shorthand for the `TriviallyRelocatable` customization point: whether
+    /// relocating a `T` can be a `memcpy` instead of a move + destroy
+    template <typename T> inline constexpr bool is_trivially_relocatable = TriviallyRelocatable<T>::value;
 
-    // TODO
+    /// Relocates `count` elements into raw memory: after the call the
+    /// elements live at `dest` and the sources are dead, as if each had been
+    /// move-constructed over and then destroyed. This is *the* primitive
+    /// every growing container needs, so it's what their growth paths share.
+    ///
+    /// For trivially relocatable types (see the `TriviallyRelocatable`
+    /// customization point) the whole range goes through one `memcpy` and no
+    /// destructors run - growth becomes bandwidth-bound. The ranges must not
+    /// overlap; relocation within one buffer is a different (and shiftier)
+    /// problem.
+    ///
+    /// If a move constructor throws partway through, the elements already
+    /// constructed at `dest` are destroyed and the exception propagates;
+    /// sources already relocated are gone. Containers want noexcept moves
+    /// here, same as the standard library's do.
+    ///
+    /// # Parameters
+    /// - `alloc`: The allocator whose `construct`/`destroy` the elements go through
+    /// - `first`: The first element to relocate
+    /// - `count`: How many elements to relocate
+    /// - `dest`: The raw memory they land in, with room for all `count`
+    ///
+    /// # Returns
+    /// One past the last relocated element at the destination
+    template <typename T, Allocator<T> A> T* uninitialized_relocate_n(A& alloc, T* first, std::size_t count, T* dest)
+    {
+        if constexpr (is_trivially_relocatable<T>)
+        {
+            if (count != 0)
+            {
+                // through void*: opted-in types aren't trivially copyable,
+                // which is exactly what the class-memaccess warning checks
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(T));
+            }
+        }
+        else
+        {
+            auto constructed = std::size_t{0};
+
+            try
+            {
+                for (; constructed < count; ++constructed)
+                {
+                    AllocTraits<A>::construct(alloc, dest + constructed, std::move(first[constructed]));
+                    AllocTraits<A>::destroy(alloc, first + constructed);
+                }
+            }
+            catch (...)
+            {
+                for (auto i = std::size_t{0}; i < constructed; ++i)
+                {
+                    AllocTraits<A>::destroy(alloc, dest + i);
+                }
+
+                throw;
+            }
+        }
+
+        return dest + count;
+    }
+
+    /// Relocates the elements in [`first`, `last`) into raw memory,
+    /// `uninitialized_relocate_n` with the count spelled as a range
+    ///
+    /// # Parameters
+    /// - `alloc`: The allocator whose `construct`/`destroy` the elements go through
+    /// - `first`: The first element to relocate
+    /// - `last`: One past the last element to relocate
+    /// - `dest`: The raw memory they land in, with room for the whole range
+    ///
+    /// # Returns
+    /// One past the last relocated element at the destination
+    template <typename T, Allocator<T> A> T* uninitialized_relocate(A& alloc, T* first, T* last, T* dest)
+    {
+        return uninitialized_relocate_n(alloc, first, static_cast<std::size_t>(last - first), dest);
+    }
 } // namespace zinc
 
-#endif
\ No newline at end of file
+#endif
@@ -20,6 +20,7 @@
 #define ZINC_UTIL_UTIL
 
 #include "zinc/util/defer.h"
+#include "zinc/util/instrument.h"
 #include "zinc/util/options.h"
 #include "zinc/util/uninitialized.h"
 
@@ -21,6 +21,7 @@
 
 #include "zinc/containers/containers.h"
 #include "zinc/io/io.h"
+#include "zinc/parallel/parallel.h"
 #include "zinc/types/types.h"
 #include "zinc/util/util.h"
 
@@ -0,0 +1,178 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/concurrent_hash_map.h"
+#include "catch2/catch.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("single-threaded operations behave like a map", "[containers][concurrent_hash_map]")
+{
+    zinc::ConcurrentHashMap<int, std::string> map;
+
+    REQUIRE(map.empty());
+    REQUIRE(map.insert_or_update(1, "one"));
+    REQUIRE(map.insert_or_update(2, "two"));
+    REQUIRE(!map.insert_or_update(1, "uno")); // update, not insert
+
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.contains(1));
+    REQUIRE(!map.contains(3));
+
+    auto seen = std::string();
+
+    REQUIRE(map.find_fn(1, [&seen](const std::string& value) {
+        seen = value;
+    }));
+    REQUIRE(seen == "uno");
+    REQUIRE(!map.find_fn(3, [](const std::string&) {}));
+
+    REQUIRE(map.modify_fn(2, [](std::string& value) {
+        value += "!";
+    }));
+    REQUIRE(map.find_fn(2, [&seen](const std::string& value) {
+        seen = value;
+    }));
+    REQUIRE(seen == "two!");
+
+    REQUIRE(!map.try_insert(2, "ignored"));
+    REQUIRE(map.try_insert(3, "three"));
+
+    REQUIRE(map.erase(1));
+    REQUIRE(!map.erase(1));
+    REQUIRE(map.size() == 2);
+
+    map.clear();
+
+    REQUIRE(map.empty());
+}
+
+TEST_CASE("every key lands in exactly one shard", "[containers][concurrent_hash_map]")
+{
+    zinc::ConcurrentHashMap<int, int> map(8);
+
+    REQUIRE(map.shard_count() == 8);
+
+    for (auto i = 0; i < 10000; ++i)
+    {
+        REQUIRE(map.try_insert(i, i * 2));
+    }
+
+    REQUIRE(map.size() == 10000);
+
+    for (auto i = 0; i < 10000; ++i)
+    {
+        auto doubled = 0;
+
+        REQUIRE(map.find_fn(i, [&doubled](int value) {
+            doubled = value;
+        }));
+        REQUIRE(doubled == i * 2);
+    }
+}
+
+TEST_CASE("concurrent writers on disjoint keys never lose an insert", "[containers][concurrent_hash_map]")
+{
+    constexpr auto writers = 8;
+    constexpr auto keys_each = 2000;
+
+    zinc::ConcurrentHashMap<int, int> map;
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < writers; ++t)
+    {
+        threads.emplace_back([&map, t] {
+            for (auto i = 0; i < keys_each; ++i)
+            {
+                map.insert_or_update(t * keys_each + i, t);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(map.size() == writers * keys_each);
+}
+
+TEST_CASE("readers keep finding while writers churn other keys", "[containers][concurrent_hash_map]")
+{
+    zinc::ConcurrentHashMap<int, int> map;
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        map.insert_or_update(i, i);
+    }
+
+    std::atomic<bool> stop = false;
+    std::atomic<int> misreads = 0;
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&map, &stop, &misreads] {
+            while (!stop.load())
+            {
+                for (auto i = 0; i < 1000; ++i)
+                {
+                    const auto found = map.find_fn(i, [i, &misreads](int value) {
+                        if (value != i)
+                        {
+                            ++misreads;
+                        }
+                    });
+
+                    if (!found)
+                    {
+                        ++misreads;
+                    }
+                }
+            }
+        });
+    }
+
+    threads.emplace_back([&map, &stop] {
+        // churns an entirely different key range
+        for (auto lap = 0; lap < 10; ++lap)
+        {
+            for (auto i = 100000; i < 100500; ++i)
+            {
+                map.insert_or_update(i, lap);
+            }
+
+            for (auto i = 100000; i < 100500; ++i)
+            {
+                map.erase(i);
+            }
+        }
+
+        stop.store(true);
+    });
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(misreads == 0);
+    REQUIRE(map.size() == 1000);
+}
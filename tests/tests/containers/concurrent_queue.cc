@@ -0,0 +1,138 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/concurrent_queue.h"
+#include "catch2/catch.hpp"
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("items come out in the order one thread pushed them", "[containers][concurrent_queue]")
+{
+    zinc::ConcurrentQueue<int> queue(16);
+
+    REQUIRE(queue.capacity() == 16);
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        REQUIRE(queue.try_push(i));
+    }
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        REQUIRE(queue.try_pop() == i);
+    }
+
+    REQUIRE(!queue.try_pop().has_value());
+}
+
+TEST_CASE("full queues refuse pushes instead of growing", "[containers][concurrent_queue]")
+{
+    zinc::ConcurrentQueue<int> queue(4);
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(queue.try_push(i));
+    }
+
+    REQUIRE(!queue.try_push(99));
+    REQUIRE(queue.try_pop() == 0);
+    REQUIRE(queue.try_push(99));
+}
+
+TEST_CASE("push_n and pop_n move batches through", "[containers][concurrent_queue]")
+{
+    zinc::ConcurrentQueue<int> queue(8);
+
+    const std::array<int, 12> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    // only the 8 that fit go in
+    REQUIRE(queue.push_n(values) == 8);
+
+    std::array<int, 12> out = {};
+
+    REQUIRE(queue.pop_n(out) == 8);
+
+    for (auto i = 0; i < 8; ++i)
+    {
+        REQUIRE(out[static_cast<std::size_t>(i)] == i);
+    }
+}
+
+TEST_CASE("nothing is lost or duplicated across producers and consumers", "[containers][concurrent_queue]")
+{
+    constexpr auto producers = 4;
+    constexpr auto consumers = 4;
+    constexpr auto items_each = 10000;
+
+    zinc::ConcurrentQueue<int> queue(64);
+    std::atomic<long long> sum = 0;
+    std::atomic<int> popped = 0;
+    std::vector<std::thread> threads;
+
+    for (auto t = 0; t < producers; ++t)
+    {
+        threads.emplace_back([&queue, t] {
+            for (auto i = 0; i < items_each; ++i)
+            {
+                while (!queue.try_push(t * items_each + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto t = 0; t < consumers; ++t)
+    {
+        threads.emplace_back([&queue, &sum, &popped] {
+            while (popped.load() < producers * items_each)
+            {
+                if (auto value = queue.try_pop(); value.has_value())
+                {
+                    sum += *value;
+                    ++popped;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto count = static_cast<long long>(producers) * items_each;
+
+    REQUIRE(popped == count);
+    REQUIRE(sum == count * (count - 1) / 2);
+}
+
+TEST_CASE("leftover items are destroyed with the queue", "[containers][concurrent_queue]")
+{
+    auto queue = std::make_unique<zinc::ConcurrentQueue<std::string>>(8);
+
+    REQUIRE(queue->try_emplace("leaks if the destructor forgets me"));
+    REQUIRE(queue->try_emplace(std::size_t{100}, 'x'));
+
+    // the sanitizer build is what actually checks this
+    queue.reset();
+}
@@ -0,0 +1,136 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/devec.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST_CASE("empty devecs behave", "[containers][devec]")
+{
+    zinc::DeVec<int> vec;
+
+    REQUIRE(vec.empty());
+    REQUIRE(vec.size() == 0);
+    REQUIRE(vec.begin() == vec.end());
+}
+
+TEST_CASE("devec stays contiguous through front and back pushes", "[containers][devec]")
+{
+    zinc::DeVec<int> vec;
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        vec.push_front(static_cast<int>(-i - 1));
+        vec.push_back(static_cast<int>(i));
+    }
+
+    REQUIRE(vec.size() == 2000);
+    REQUIRE(vec.front() == -1000);
+    REQUIRE(vec.back() == 999);
+
+    // the whole point of DeVec over RingDeque: data() really is one array
+    for (auto i : zinc::range(0, 2000))
+    {
+        REQUIRE(vec.data()[i] == vec[static_cast<std::size_t>(i)]);
+    }
+
+    REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+}
+
+TEST_CASE("one-sided pushing still completes in reasonable shape", "[containers][devec]")
+{
+    zinc::DeVec<std::string> vec;
+
+    // worst case for the centering strategy: every insert lands on the front
+    for (auto i : zinc::range(0, 2000))
+    {
+        vec.push_front("value-" + std::to_string(i));
+    }
+
+    REQUIRE(vec.size() == 2000);
+
+    for (auto [i, value] : zinc::enumerate(vec))
+    {
+        REQUIRE(value == "value-" + std::to_string(1999 - i));
+    }
+}
+
+TEST_CASE("recentering happens in place when slack allows", "[containers][devec]")
+{
+    zinc::DeVec<int> vec;
+
+    vec.reserve(1024);
+
+    const auto capacity = vec.capacity();
+
+    // reserve centers the (empty) contents, so 700 back-pushes blow through
+    // the back slack and force a recenter - but never an actual reallocation,
+    // since plenty of room is left over on the front side
+    for (auto i : zinc::range(0, 700))
+    {
+        vec.push_back(static_cast<int>(i));
+    }
+
+    REQUIRE(vec.capacity() == capacity);
+    REQUIRE(vec.size() == 700);
+    REQUIRE(std::is_sorted(vec.begin(), vec.end()));
+}
+
+TEST_CASE("devec indexing and bounds checking work", "[containers][devec]")
+{
+    zinc::DeVec<int> vec = {10, 20, 30};
+
+    REQUIRE(vec[0] == 10);
+    REQUIRE(vec[2] == 30);
+    REQUIRE(vec.at(1) == 20);
+    REQUIRE_THROWS_AS(vec.at(3), std::out_of_range);
+}
+
+TEST_CASE("devec copies and moves preserve contents", "[containers][devec]")
+{
+    zinc::DeVec<std::string> vec = {"a", "b", "c"};
+
+    vec.push_front("front");
+
+    auto copy = vec;
+
+    REQUIRE(copy == vec);
+
+    auto moved = std::move(copy);
+
+    REQUIRE(moved == vec);
+    REQUIRE(copy.empty()); // NOLINT: intentional use-after-move
+}
+
+TEST_CASE("devec resize grows and shrinks from the back", "[containers][devec]")
+{
+    zinc::DeVec<int> vec = {1, 2, 3};
+
+    vec.resize(5);
+
+    REQUIRE(vec.size() == 5);
+    REQUIRE(vec[4] == 0);
+
+    vec.resize(1);
+
+    REQUIRE(vec.size() == 1);
+    REQUIRE(vec.front() == 1);
+}
@@ -0,0 +1,195 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/frozen_hash_map.h"
+#include "catch2/catch.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+namespace
+{
+    // deletes the snapshot file when a test section ends, pass or fail
+    struct TempSnapshot
+    {
+        explicit TempSnapshot(const char* name)
+            : path(std::filesystem::temp_directory_path() / name)
+        {}
+
+        TempSnapshot(const TempSnapshot&) = delete;
+
+        TempSnapshot& operator=(const TempSnapshot&) = delete;
+
+        ~TempSnapshot()
+        {
+            auto code = std::error_code();
+
+            std::filesystem::remove(path, code);
+        }
+
+        std::filesystem::path path;
+    };
+
+    struct Record
+    {
+        std::uint64_t id;
+        std::uint32_t flags;
+    };
+} // namespace
+
+TEST_CASE("FrozenHashMap round-trips a saved HashMap", "[containers][frozen_hash_map]")
+{
+    const auto temp = TempSnapshot("zinc_frozen_map_test.snap");
+    auto map = zinc::HashMap<std::uint64_t, std::uint64_t>();
+
+    for (auto key = std::uint64_t{0}; key < 10000; ++key)
+    {
+        map.emplace(key * 3, key);
+    }
+
+    zinc::save_snapshot(map, temp.path);
+
+    const auto frozen = zinc::FrozenHashMap<std::uint64_t, std::uint64_t>(temp.path);
+
+    REQUIRE(frozen.size() == map.size());
+    REQUIRE(frozen.bucket_count() == map.bucket_count());
+
+    for (auto key = std::uint64_t{0}; key < 10000; ++key)
+    {
+        REQUIRE(frozen.contains(key * 3));
+        REQUIRE(frozen.at(key * 3) == key);
+    }
+
+    // misses stay misses
+    REQUIRE(!frozen.contains(1));
+    REQUIRE(frozen.find(29999) == frozen.end());
+    REQUIRE_THROWS_AS(frozen.at(1), std::out_of_range);
+}
+
+TEST_CASE("FrozenHashMap iteration visits every entry once", "[containers][frozen_hash_map]")
+{
+    const auto temp = TempSnapshot("zinc_frozen_map_iter_test.snap");
+    auto map = zinc::HashMap<std::uint64_t, std::uint64_t>();
+
+    for (auto key = std::uint64_t{1}; key <= 500; ++key)
+    {
+        map.emplace(key, key * key);
+    }
+
+    zinc::save_snapshot(map, temp.path);
+
+    const auto frozen = zinc::FrozenHashMap<std::uint64_t, std::uint64_t>(temp.path);
+    auto seen = std::unordered_map<std::uint64_t, std::uint64_t>();
+
+    for (const auto& [key, value] : frozen)
+    {
+        REQUIRE(seen.emplace(key, value).second);
+    }
+
+    REQUIRE(seen.size() == 500);
+
+    for (auto key = std::uint64_t{1}; key <= 500; ++key)
+    {
+        REQUIRE(seen.at(key) == key * key);
+    }
+}
+
+TEST_CASE("FrozenHashMap handles struct values and empty maps", "[containers][frozen_hash_map]")
+{
+    const auto temp = TempSnapshot("zinc_frozen_map_record_test.snap");
+
+    SECTION("trivially copyable struct values survive the round trip")
+    {
+        auto map = zinc::HashMap<std::uint64_t, Record>();
+
+        map.emplace(42, Record{.id = 42, .flags = 7});
+        map.emplace(99, Record{.id = 99, .flags = 1});
+
+        zinc::save_snapshot(map, temp.path);
+
+        const auto frozen = zinc::FrozenHashMap<std::uint64_t, Record>(temp.path);
+
+        REQUIRE(frozen.at(42).flags == 7);
+        REQUIRE(frozen.at(99).id == 99);
+    }
+
+    SECTION("an empty map snapshots to a loadable empty view")
+    {
+        zinc::save_snapshot(zinc::HashMap<std::uint64_t, Record>(), temp.path);
+
+        const auto frozen = zinc::FrozenHashMap<std::uint64_t, Record>(temp.path);
+
+        REQUIRE(frozen.empty());
+        REQUIRE(!frozen.contains(42));
+        REQUIRE(frozen.begin() == frozen.end());
+    }
+}
+
+TEST_CASE("FrozenHashMap rejects files that aren't usable snapshots", "[containers][frozen_hash_map]")
+{
+    const auto temp = TempSnapshot("zinc_frozen_map_bad_test.snap");
+
+    SECTION("garbage isn't a snapshot")
+    {
+        std::ofstream(temp.path, std::ios_base::binary) << "definitely not a snapshot";
+
+        REQUIRE_THROWS_AS((zinc::FrozenHashMap<std::uint64_t, std::uint64_t>(temp.path)), zinc::BadSnapshot);
+    }
+
+    SECTION("a snapshot of differently-sized slots is a mismatch")
+    {
+        auto map = zinc::HashMap<std::uint64_t, std::uint64_t>();
+
+        map.emplace(1, 2);
+        zinc::save_snapshot(map, temp.path);
+
+        REQUIRE_THROWS_AS((zinc::FrozenHashMap<std::uint64_t, Record>(temp.path)), zinc::BadSnapshot);
+    }
+
+    SECTION("a fabricated bucket count is corrupt")
+    {
+        auto map = zinc::HashMap<std::uint64_t, std::uint64_t>();
+
+        map.emplace(1, 2);
+        zinc::save_snapshot(map, temp.path);
+
+        // bucket_count is the fourth u64 in the header; 24 is neither a
+        // power of two nor a multiple of any group width, and probing a
+        // table shaped like that would run off the end of the meta array
+        const auto patched = std::uint64_t{24};
+        auto out = std::fstream(temp.path, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+
+        out.seekp(3 * sizeof(std::uint64_t));
+        out.write(reinterpret_cast<const char*>(&patched), sizeof(patched)); // NOLINT: bytes are the point
+        out.close();
+
+        REQUIRE_THROWS_AS((zinc::FrozenHashMap<std::uint64_t, std::uint64_t>(temp.path)), zinc::BadSnapshot);
+    }
+
+    SECTION("a truncated snapshot is corrupt")
+    {
+        auto map = zinc::HashMap<std::uint64_t, std::uint64_t>();
+
+        map.emplace(1, 2);
+        zinc::save_snapshot(map, temp.path);
+        std::filesystem::resize_file(temp.path, std::filesystem::file_size(temp.path) / 2);
+
+        REQUIRE_THROWS_AS((zinc::FrozenHashMap<std::uint64_t, std::uint64_t>(temp.path)), zinc::BadSnapshot);
+    }
+}
@@ -0,0 +1,150 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/graph.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <string>
+#include <vector>
+
+TEST_CASE("empty graphs behave", "[containers][graph]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    auto graph = builder.build();
+
+    REQUIRE(graph.node_count() == 0);
+    REQUIRE(graph.edge_count() == 0);
+}
+
+TEST_CASE("building compresses edges into per-node runs", "[containers][graph]")
+{
+    zinc::GraphBuilder<std::string> builder;
+
+    auto a = builder.add_node("a");
+    auto b = builder.add_node("b");
+    auto c = builder.add_node("c");
+    auto d = builder.add_node("d");
+
+    builder.add_edge(a, b);
+    builder.add_edge(c, a);
+    builder.add_edge(a, c);
+    builder.add_edge(b, d);
+    builder.add_edge(a, d);
+
+    auto graph = builder.build();
+
+    REQUIRE(graph.node_count() == 4);
+    REQUIRE(graph.edge_count() == 5);
+
+    // each node's neighbors come back in the order the edges were added
+    const auto a_neighbors = graph.neighbors(a);
+    const std::vector<zinc::Graph<std::string>::node_type> expected = {b, c, d};
+
+    REQUIRE(std::equal(a_neighbors.begin(), a_neighbors.end(), expected.begin(), expected.end()));
+    REQUIRE(graph.out_degree(b) == 1);
+    REQUIRE(graph.neighbors(b)[0] == d);
+    REQUIRE(graph.out_degree(c) == 1);
+    REQUIRE(graph.out_degree(d) == 0);
+}
+
+TEST_CASE("node payloads are readable and writable after build", "[containers][graph]")
+{
+    zinc::GraphBuilder<std::string> builder;
+
+    auto a = builder.add_node("first");
+    auto b = builder.add_node("second");
+
+    builder.add_edge(a, b);
+
+    auto graph = builder.build();
+
+    REQUIRE(graph[a] == "first");
+    REQUIRE(graph[b] == "second");
+
+    graph[a] = "updated";
+
+    REQUIRE(graph[a] == "updated");
+}
+
+TEST_CASE("neighbor spans view one contiguous edge array", "[containers][graph]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    for (auto i : zinc::range(0, 16))
+    {
+        builder.add_node(static_cast<int>(i));
+    }
+
+    // ring: every node points at the next one
+    for (auto i : zinc::range(0, 16))
+    {
+        builder.add_edge(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>((i + 1) % 16));
+    }
+
+    auto graph = builder.build();
+
+    // consecutive nodes' runs are adjacent in memory - the CSR guarantee
+    for (auto i : zinc::range(0, 15))
+    {
+        const auto current = graph.neighbors(static_cast<std::uint32_t>(i));
+        const auto next = graph.neighbors(static_cast<std::uint32_t>(i + 1));
+
+        REQUIRE(current.data() + current.size() == next.data());
+    }
+}
+
+TEST_CASE("parallel edges and self-loops are preserved", "[containers][graph]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    auto a = builder.add_node(0);
+    auto b = builder.add_node(1);
+
+    builder.add_edge(a, b);
+    builder.add_edge(a, b);
+    builder.add_edge(b, b);
+
+    auto graph = builder.build();
+
+    REQUIRE(graph.out_degree(a) == 2);
+    REQUIRE(graph.neighbors(a)[0] == b);
+    REQUIRE(graph.neighbors(a)[1] == b);
+    REQUIRE(graph.neighbors(b)[0] == b);
+}
+
+TEST_CASE("builders are reusable after build", "[containers][graph]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    auto a = builder.add_node(1);
+
+    builder.add_edge(a, a);
+
+    auto first = builder.build();
+
+    REQUIRE(first.node_count() == 1);
+    REQUIRE(first.edge_count() == 1);
+
+    auto b = builder.add_node(2);
+    auto second = builder.build();
+
+    REQUIRE(second.node_count() == 1);
+    REQUIRE(second.edge_count() == 0);
+    REQUIRE(second[b] == 2);
+}
@@ -0,0 +1,193 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/graph_algorithms.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    using Node = zinc::Graph<int>::node_type;
+
+    // every edge must point forward in a valid topological order
+    bool is_topological(const zinc::Graph<int>& graph, const std::vector<Node>& order)
+    {
+        std::vector<std::size_t> position(graph.node_count());
+
+        for (auto [i, node] : zinc::enumerate(order))
+        {
+            position[node] = i;
+        }
+
+        for (auto node = Node{0}; node < graph.node_count(); ++node)
+        {
+            for (auto neighbor : graph.neighbors(node))
+            {
+                if (position[node] >= position[neighbor])
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+} // namespace
+
+TEST_CASE("bfs reports level-by-level distances", "[containers][graph_algorithms]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    auto a = builder.add_node(0);
+    auto b = builder.add_node(1);
+    auto c = builder.add_node(2);
+    auto d = builder.add_node(3);
+    auto isolated = builder.add_node(4);
+
+    builder.add_edge(a, b);
+    builder.add_edge(a, c);
+    builder.add_edge(b, d);
+    builder.add_edge(c, d);
+
+    auto graph = builder.build();
+    auto distances = zinc::bfs_distances(graph, a);
+
+    REQUIRE(distances[a] == 0);
+    REQUIRE(distances[b] == 1);
+    REQUIRE(distances[c] == 1);
+    REQUIRE(distances[d] == 2);
+    REQUIRE(distances[isolated] == zinc::unreachable_distance);
+}
+
+TEST_CASE("parallel bfs agrees with the serial path on a large grid", "[containers][graph_algorithms]")
+{
+    // a 100x100 grid graph, edges pointing right and down - frontiers get
+    // big enough here to actually cross the parallel threshold
+    constexpr auto side = std::size_t{100};
+
+    zinc::GraphBuilder<int> builder;
+
+    for (auto i : zinc::range(0, side * side))
+    {
+        builder.add_node(static_cast<int>(i));
+    }
+
+    for (auto row = std::size_t{0}; row < side; ++row)
+    {
+        for (auto col = std::size_t{0}; col < side; ++col)
+        {
+            const auto node = static_cast<Node>(row * side + col);
+
+            if (col + 1 < side)
+            {
+                builder.add_edge(node, node + 1);
+            }
+
+            if (row + 1 < side)
+            {
+                builder.add_edge(node, static_cast<Node>(node + side));
+            }
+        }
+    }
+
+    auto graph = builder.build();
+    auto serial = zinc::bfs_distances(graph, 0, 1);
+    auto parallel = zinc::bfs_distances(graph, 0, 4);
+
+    REQUIRE(serial == parallel);
+
+    // on a grid, distance from the corner is just manhattan distance
+    REQUIRE(serial[side * side - 1] == 2 * (side - 1));
+}
+
+TEST_CASE("topological sort orders a diamond", "[containers][graph_algorithms]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    auto a = builder.add_node(0);
+    auto b = builder.add_node(1);
+    auto c = builder.add_node(2);
+    auto d = builder.add_node(3);
+
+    builder.add_edge(a, b);
+    builder.add_edge(a, c);
+    builder.add_edge(b, d);
+    builder.add_edge(c, d);
+
+    auto graph = builder.build();
+    auto order = zinc::topological_sort(graph);
+
+    REQUIRE(order.has_value());
+    REQUIRE(order->size() == 4);
+    REQUIRE(is_topological(graph, *order));
+    REQUIRE(order->front() == a);
+    REQUIRE(order->back() == d);
+}
+
+TEST_CASE("topological sort detects cycles", "[containers][graph_algorithms]")
+{
+    zinc::GraphBuilder<int> builder;
+
+    auto a = builder.add_node(0);
+    auto b = builder.add_node(1);
+    auto c = builder.add_node(2);
+
+    builder.add_edge(a, b);
+    builder.add_edge(b, c);
+    builder.add_edge(c, a);
+
+    auto graph = builder.build();
+
+    REQUIRE_FALSE(zinc::topological_sort(graph).has_value());
+}
+
+TEST_CASE("parallel topological sort stays valid on a wide dag", "[containers][graph_algorithms]")
+{
+    // layered dag: 64 layers of 128 nodes, each node depending on every node
+    // in the previous layer, so the ready batches are wide
+    constexpr auto layers = std::size_t{64};
+    constexpr auto width = std::size_t{128};
+
+    zinc::GraphBuilder<int> builder;
+
+    for (auto i : zinc::range(0, layers * width))
+    {
+        builder.add_node(static_cast<int>(i));
+    }
+
+    for (auto layer = std::size_t{1}; layer < layers; ++layer)
+    {
+        for (auto from = std::size_t{0}; from < width; ++from)
+        {
+            for (auto to = std::size_t{0}; to < width; ++to)
+            {
+                builder.add_edge(static_cast<Node>((layer - 1) * width + from),
+                    static_cast<Node>(layer * width + to));
+            }
+        }
+    }
+
+    auto graph = builder.build();
+    auto order = zinc::topological_sort(graph, 4);
+
+    REQUIRE(order.has_value());
+    REQUIRE(order->size() == layers * width);
+    REQUIRE(is_topological(graph, *order));
+}
@@ -0,0 +1,81 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/hash_map.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <string>
+#include <string_view>
+
+TEST_CASE("string maps can be probed without building a std::string", "[containers][hash_map]")
+{
+    zinc::HashMap<std::string, int> map;
+
+    for (auto i : zinc::range(0, 500))
+    {
+        map.insert({"key-" + std::to_string(i), static_cast<int>(i)});
+    }
+
+    // literals and views go straight into the hasher / comparator, nothing
+    // here should ever allocate a temporary key
+    REQUIRE(map.contains("key-42"));
+    REQUIRE(map.contains(std::string_view{"key-137"}));
+    REQUIRE_FALSE(map.contains("key-500"));
+
+    const auto it = map.find(std::string_view{"key-250"});
+
+    REQUIRE(it != map.end());
+    REQUIRE(it->second == 250);
+}
+
+TEST_CASE("operator[] inserts defaults and finds existing values", "[containers][hash_map]")
+{
+    zinc::HashMap<std::string, int> map;
+
+    map["counter"] += 1;
+    map["counter"] += 1;
+
+    REQUIRE(map.size() == 1);
+    REQUIRE(map["counter"] == 2);
+    REQUIRE(map.at("counter") == 2);
+    REQUIRE_THROWS_AS(map.at("missing"), std::out_of_range);
+}
+
+TEST_CASE("try_emplace only constructs on new keys", "[containers][hash_map]")
+{
+    zinc::HashMap<int, std::string> map;
+
+    REQUIRE(map.try_emplace(1, "first").second);
+    REQUIRE_FALSE(map.try_emplace(1, "second").second);
+    REQUIRE(map.find(1)->second == "first");
+    REQUIRE(map.size() == 1);
+}
+
+TEST_CASE("transparent and owning-key lookups agree", "[containers][hash_map]")
+{
+    zinc::HashMap<std::string, int> map;
+
+    map.insert({"alpha", 1});
+    map.insert({"beta", 2});
+
+    for (const auto* key : {"alpha", "beta", "gamma"})
+    {
+        REQUIRE(map.find(key) == map.find(std::string{key}));
+        REQUIRE(map.find(std::string_view{key}) == map.find(std::string{key}));
+    }
+}
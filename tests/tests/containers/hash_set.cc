@@ -0,0 +1,439 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/hash_set.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("empty sets behave", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    REQUIRE(set.empty());
+    REQUIRE(set.size() == 0);
+    REQUIRE(set.find(42) == set.end());
+    REQUIRE_FALSE(set.contains(42));
+}
+
+TEST_CASE("inserted keys are found again", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    for (auto i : zinc::range(0, 5000))
+    {
+        const auto [it, inserted] = set.insert(static_cast<int>(i));
+
+        REQUIRE(inserted);
+        REQUIRE(*it == i);
+    }
+
+    REQUIRE(set.size() == 5000);
+
+    for (auto i : zinc::range(0, 5000))
+    {
+        REQUIRE(set.contains(static_cast<int>(i)));
+    }
+
+    for (auto i : zinc::range(5000, 10000))
+    {
+        REQUIRE_FALSE(set.contains(static_cast<int>(i)));
+    }
+}
+
+TEST_CASE("duplicate inserts are rejected", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    REQUIRE(set.insert(1).second);
+    REQUIRE_FALSE(set.insert(1).second);
+    REQUIRE(set.size() == 1);
+}
+
+TEST_CASE("erased keys stop being found", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        if (i % 2 == 0)
+        {
+            set.erase(static_cast<int>(i));
+        }
+    }
+
+    REQUIRE(set.size() == 500);
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        REQUIRE(set.contains(static_cast<int>(i)) == (i % 2 != 0));
+    }
+}
+
+TEST_CASE("erased slots get reused", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    set.insert(7);
+    set.erase(7);
+
+    REQUIRE_FALSE(set.contains(7));
+    REQUIRE(set.insert(7).second);
+    REQUIRE(set.contains(7));
+    REQUIRE(set.size() == 1);
+}
+
+TEST_CASE("string keys survive rehashing", "[containers][hash_set]")
+{
+    zinc::HashSet<std::string> set;
+
+    for (auto i : zinc::range(0, 2000))
+    {
+        set.insert("key-" + std::to_string(i));
+    }
+
+    REQUIRE(set.size() == 2000);
+
+    for (auto i : zinc::range(0, 2000))
+    {
+        REQUIRE(set.contains("key-" + std::to_string(i)));
+    }
+
+    REQUIRE_FALSE(set.contains(std::string{"key-2000"}));
+}
+
+TEST_CASE("begin stays correct as elements come and go", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    REQUIRE(set.begin() == set.end());
+
+    for (auto i : zinc::range(0, 64))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    // erase whatever happens to be first, repeatedly; begin() must keep
+    // tracking the new first element until the set runs dry
+    while (!set.empty())
+    {
+        const auto previous = set.size();
+
+        set.erase(*set.begin());
+
+        REQUIRE(set.size() == previous - 1);
+    }
+
+    REQUIRE(set.begin() == set.end());
+}
+
+TEST_CASE("iteration of a mostly-sparse set visits only live elements", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    for (auto i : zinc::range(0, 4096))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    for (auto i : zinc::range(0, 4096))
+    {
+        if (i % 64 != 0)
+        {
+            set.erase(static_cast<int>(i));
+        }
+    }
+
+    auto count = std::size_t{0};
+
+    for (auto value : set)
+    {
+        REQUIRE(value % 64 == 0);
+        ++count;
+    }
+
+    REQUIRE(count == set.size());
+    REQUIRE(count == 64);
+}
+
+TEST_CASE("churning keys does not grow the table unboundedly", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    // weeks of insert/erase churn in miniature: tombstones must get reclaimed
+    // by the rehash policy rather than pushing capacity up round after round
+    for (auto round : zinc::range(0, 500))
+    {
+        for (auto i : zinc::range(0, 20))
+        {
+            set.insert(static_cast<int>(round * 20 + i));
+        }
+
+        for (auto i : zinc::range(0, 20))
+        {
+            set.erase(static_cast<int>(round * 20 + i));
+        }
+    }
+
+    REQUIRE(set.empty());
+    REQUIRE(set.bucket_count() <= 128);
+}
+
+TEST_CASE("find_many agrees with find for present and absent keys", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+    std::vector<int> keys;
+    std::vector<zinc::HashSet<int>::iterator> results;
+
+    for (auto i : zinc::range(0, 3000))
+    {
+        set.insert(static_cast<int>(i * 2)); // evens only
+    }
+
+    for (auto i : zinc::range(0, 500))
+    {
+        keys.push_back(static_cast<int>(i)); // every other key misses
+    }
+
+    set.find_many(keys, std::back_inserter(results));
+
+    REQUIRE(results.size() == keys.size());
+
+    for (auto [i, it] : zinc::enumerate(results))
+    {
+        REQUIRE(it == set.find(keys[i]));
+
+        if (keys[i] % 2 == 0)
+        {
+            REQUIRE(*it == keys[i]);
+        }
+        else
+        {
+            REQUIRE(it == set.end());
+        }
+    }
+}
+
+TEST_CASE("find_many on an empty set yields all end()", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+    std::vector<int> keys = {1, 2, 3};
+    std::vector<zinc::HashSet<int>::iterator> results;
+
+    set.find_many(keys, std::back_inserter(results));
+
+    REQUIRE(results.size() == 3);
+    REQUIRE(std::all_of(results.begin(), results.end(), [&](auto it) { return it == set.end(); }));
+}
+
+TEST_CASE("precomputed hash tokens behave exactly like plain lookups", "[containers][hash_set]")
+{
+    zinc::HashSet<std::string> set;
+
+    for (auto i : zinc::range(0, 200))
+    {
+        const auto key = "token-" + std::to_string(i);
+        const zinc::HashToken token(set.hash_function()(key));
+
+        REQUIRE(set.emplace_with_hash(token, key).second);
+        REQUIRE_FALSE(set.emplace_with_hash(token, key).second);
+    }
+
+    for (auto i : zinc::range(0, 200))
+    {
+        const auto key = "token-" + std::to_string(i);
+        const zinc::HashToken token(set.hash_function()(key));
+
+        REQUIRE(set.find(token, key) == set.find(key));
+        REQUIRE(*set.find(token, key) == key);
+    }
+
+    const std::string missing = "not-here";
+
+    REQUIRE(set.find(zinc::HashToken(set.hash_function()(missing)), missing) == set.end());
+}
+
+TEST_CASE("reserve makes room for that many elements", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    set.reserve(1000);
+
+    const auto buckets = set.bucket_count();
+
+    // reserve(n) is "n *elements* without rehashing", not "n buckets"
+    REQUIRE(static_cast<float>(buckets) * 0.72f >= 1000.f);
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    REQUIRE(set.bucket_count() == buckets);
+}
+
+TEST_CASE("range insert reserves up front for forward iterators", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+    std::vector<int> values;
+
+    for (auto i : zinc::range(0, 3000))
+    {
+        values.push_back(static_cast<int>(i));
+    }
+
+    set.insert(values.begin(), values.end());
+
+    REQUIRE(set.size() == 3000);
+
+    const auto buckets = set.bucket_count();
+
+    for (auto value : values)
+    {
+        REQUIRE(set.contains(value));
+    }
+
+    REQUIRE(set.bucket_count() == buckets);
+}
+
+TEST_CASE("shrink_to_fit rehashes down after mass erasure", "[containers][hash_set]")
+{
+    zinc::HashSet<std::string> set;
+
+    for (auto i : zinc::range(0, 10000))
+    {
+        set.insert("entry-" + std::to_string(i));
+    }
+
+    const auto grown = set.bucket_count();
+
+    for (auto i : zinc::range(100, 10000))
+    {
+        set.erase("entry-" + std::to_string(i));
+    }
+
+    set.shrink_to_fit();
+
+    REQUIRE(set.bucket_count() < grown);
+    REQUIRE(set.size() == 100);
+
+    for (auto i : zinc::range(0, 100))
+    {
+        REQUIRE(set.contains("entry-" + std::to_string(i)));
+    }
+}
+
+TEST_CASE("clear_and_release gives the allocation back", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    set.clear_and_release();
+
+    REQUIRE(set.empty());
+    REQUIRE(set.bucket_count() == 0);
+    REQUIRE_FALSE(set.contains(1));
+
+    // and the table has to come back to life afterwards
+    set.insert(42);
+
+    REQUIRE(set.contains(42));
+    REQUIRE(set.size() == 1);
+}
+
+TEST_CASE("clear_and_release on an empty set is a no-op", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    set.clear_and_release();
+    set.shrink_to_fit();
+
+    REQUIRE(set.empty());
+    REQUIRE(set.bucket_count() == 0);
+}
+
+TEST_CASE("string sets support heterogeneous lookup", "[containers][hash_set]")
+{
+    zinc::HashSet<std::string> set;
+
+    set.insert("present");
+
+    REQUIRE(set.contains("present"));
+    REQUIRE(set.contains(std::string_view{"present"}));
+    REQUIRE_FALSE(set.contains("absent"));
+    REQUIRE(set.find(std::string_view{"present"}) == set.find(std::string{"present"}));
+}
+
+TEST_CASE("table stats track probes, rehashes and tombstones", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+
+    REQUIRE(set.stats().operations == 0);
+    REQUIRE(set.stats().mean_probe_length() == 0.0);
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    const auto after_insert = set.stats();
+
+    REQUIRE(after_insert.operations >= 1000);
+    REQUIRE(after_insert.probes >= after_insert.operations);
+    REQUIRE(after_insert.max_probe_length >= 1);
+    REQUIRE(after_insert.mean_probe_length() >= 1.0);
+    REQUIRE(after_insert.rehashes >= 1); // 1000 elements can't fit in the initial table
+
+    for (auto i : zinc::range(0, 10))
+    {
+        set.erase(static_cast<int>(i));
+    }
+
+    REQUIRE(set.stats().tombstones == 10);
+}
+
+TEST_CASE("iteration visits every element exactly once", "[containers][hash_set]")
+{
+    zinc::HashSet<int> set;
+    auto total = 0;
+
+    for (auto i : zinc::range(1, 101))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    for (auto value : set)
+    {
+        total += value;
+    }
+
+    REQUIRE(total == 5050);
+}
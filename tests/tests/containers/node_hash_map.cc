@@ -0,0 +1,132 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/node_hash_map.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <string>
+#include <vector>
+
+TEST_CASE("node maps insert, look up and erase", "[containers][node_hash_map]")
+{
+    zinc::NodeHashMap<std::string, int> map;
+
+    map.emplace("one", 1);
+    map.emplace("two", 2);
+    map["three"] = 3;
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at("one") == 1);
+    REQUIRE(map.at("three") == 3);
+    REQUIRE(map.contains("two"));
+
+    map.erase("two");
+
+    REQUIRE_FALSE(map.contains("two"));
+    REQUIRE(map.size() == 2);
+}
+
+TEST_CASE("node map references survive any amount of rehashing", "[containers][node_hash_map]")
+{
+    zinc::NodeHashMap<int, std::string> map;
+    std::vector<const std::string*> values;
+    std::vector<const int*> keys;
+
+    for (auto i : zinc::range(0, 100))
+    {
+        auto [it, inserted] = map.emplace(static_cast<int>(i), "value-" + std::to_string(i));
+
+        REQUIRE(inserted);
+
+        keys.push_back(&it->first);
+        values.push_back(&it->second);
+    }
+
+    // grow the table far past its original capacity; a flat map would have
+    // moved every element several times over by now
+    for (auto i : zinc::range(100, 10000))
+    {
+        map.emplace(static_cast<int>(i), std::to_string(i));
+    }
+
+    for (auto i : zinc::range(0, 100))
+    {
+        REQUIRE(*keys[static_cast<std::size_t>(i)] == static_cast<int>(i));
+        REQUIRE(*values[static_cast<std::size_t>(i)] == "value-" + std::to_string(i));
+    }
+}
+
+TEST_CASE("node map erase and re-insert churn stays clean", "[containers][node_hash_map]")
+{
+    zinc::NodeHashMap<int, std::string> map;
+
+    // freed nodes go back onto the pool's free list and get re-used by the
+    // next wave, so heavy churn shouldn't touch the heap at all once warm
+    for (auto round : zinc::range(0, 10))
+    {
+        for (auto i : zinc::range(0, 500))
+        {
+            map.emplace(static_cast<int>(i), std::to_string(round));
+        }
+
+        for (auto i : zinc::range(0, 500))
+        {
+            map.erase(static_cast<int>(i));
+        }
+    }
+
+    REQUIRE(map.empty());
+
+    map.emplace(1, "done");
+
+    REQUIRE(map.at(1) == "done");
+}
+
+TEST_CASE("node map copies are deep", "[containers][node_hash_map]")
+{
+    zinc::NodeHashMap<std::string, std::string> map;
+
+    map.emplace("a", "1");
+    map.emplace("b", "2");
+
+    auto copy = map;
+
+    copy.at("a") = "changed";
+    copy.emplace("c", "3");
+
+    REQUIRE(map.at("a") == "1");
+    REQUIRE(map.size() == 2);
+    REQUIRE(copy.at("a") == "changed");
+    REQUIRE(copy.size() == 3);
+
+    auto moved = std::move(copy);
+
+    REQUIRE(moved.at("a") == "changed");
+    REQUIRE(moved.size() == 3);
+}
+
+TEST_CASE("node maps probe transparently with string keys", "[containers][node_hash_map]")
+{
+    zinc::NodeHashMap<std::string, int> map;
+
+    map.emplace("interned", 42);
+
+    REQUIRE(map.contains(std::string_view{"interned"}));
+    REQUIRE(map.find("interned") != map.end());
+    REQUIRE(map.count("missing") == 0);
+}
@@ -0,0 +1,173 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/ring_deque.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST_CASE("empty deques behave", "[containers][ring_deque]")
+{
+    zinc::RingDeque<int> deque;
+
+    REQUIRE(deque.empty());
+    REQUIRE(deque.size() == 0);
+    REQUIRE(deque.begin() == deque.end());
+}
+
+TEST_CASE("pushing at both ends preserves logical order", "[containers][ring_deque]")
+{
+    zinc::RingDeque<int> deque;
+
+    // ends up as 4 3 2 1 0 | 0 1 2 3 4
+    for (auto i : zinc::range(0, 5))
+    {
+        deque.push_front(static_cast<int>(i));
+        deque.push_back(static_cast<int>(i));
+    }
+
+    REQUIRE(deque.size() == 10);
+    REQUIRE(deque.front() == 4);
+    REQUIRE(deque.back() == 4);
+
+    const std::vector<int> expected = {4, 3, 2, 1, 0, 0, 1, 2, 3, 4};
+
+    REQUIRE(std::equal(deque.begin(), deque.end(), expected.begin(), expected.end()));
+}
+
+TEST_CASE("the ring survives wrapping around many times", "[containers][ring_deque]")
+{
+    zinc::RingDeque<int> deque;
+
+    for (auto i : zinc::range(0, 10000))
+    {
+        deque.push_back(static_cast<int>(i));
+
+        if (i % 3 != 0)
+        {
+            deque.pop_front();
+        }
+    }
+
+    // every third element sticks around, and order is preserved
+    auto expected = 0;
+
+    for (auto value : deque)
+    {
+        (void)value;
+        ++expected;
+    }
+
+    REQUIRE(static_cast<std::size_t>(expected) == deque.size());
+    REQUIRE(std::is_sorted(deque.begin(), deque.end()));
+}
+
+TEST_CASE("growth linearizes without losing elements", "[containers][ring_deque]")
+{
+    zinc::RingDeque<std::string> deque;
+
+    // shove the head into the middle of the buffer so growth has to
+    // stitch the two halves of the ring back together
+    for ([[maybe_unused]] auto i : zinc::range(0, 6))
+    {
+        deque.push_back("x");
+        deque.pop_front();
+    }
+
+    for (auto i : zinc::range(0, 100))
+    {
+        deque.push_back("value-" + std::to_string(i));
+    }
+
+    REQUIRE(deque.size() == 100);
+
+    for (auto [i, value] : zinc::enumerate(deque))
+    {
+        REQUIRE(value == "value-" + std::to_string(i));
+    }
+}
+
+TEST_CASE("indexing and bounds checking work", "[containers][ring_deque]")
+{
+    zinc::RingDeque<int> deque = {10, 20, 30};
+
+    REQUIRE(deque[0] == 10);
+    REQUIRE(deque[2] == 30);
+    REQUIRE(deque.at(1) == 20);
+    REQUIRE_THROWS_AS(deque.at(3), std::out_of_range);
+}
+
+TEST_CASE("bulk push and pop move whole batches", "[containers][ring_deque]")
+{
+    zinc::RingDeque<int> deque;
+    std::vector<int> batch;
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        batch.push_back(static_cast<int>(i));
+    }
+
+    // offset the head first so the batch has to wrap
+    deque.push_back(-1);
+    deque.push_back(-2);
+    deque.pop_front();
+    deque.pop_front();
+
+    deque.push_back_n(batch);
+
+    REQUIRE(deque.size() == 1000);
+    REQUIRE(std::equal(deque.begin(), deque.end(), batch.begin(), batch.end()));
+
+    deque.pop_front_n(900);
+
+    REQUIRE(deque.size() == 100);
+    REQUIRE(deque.front() == 900);
+    REQUIRE(deque.back() == 999);
+}
+
+TEST_CASE("copies and moves preserve contents", "[containers][ring_deque]")
+{
+    zinc::RingDeque<std::string> deque = {"a", "b", "c"};
+
+    auto copy = deque;
+
+    REQUIRE(copy == deque);
+
+    auto moved = std::move(copy);
+
+    REQUIRE(moved == deque);
+    REQUIRE(copy.empty()); // NOLINT: intentional use-after-move
+}
+
+TEST_CASE("resize grows and shrinks from the back", "[containers][ring_deque]")
+{
+    zinc::RingDeque<int> deque = {1, 2, 3};
+
+    deque.resize(5);
+
+    REQUIRE(deque.size() == 5);
+    REQUIRE(deque[3] == 0);
+    REQUIRE(deque[4] == 0);
+
+    deque.resize(2);
+
+    REQUIRE(deque.size() == 2);
+    REQUIRE(deque.back() == 2);
+}
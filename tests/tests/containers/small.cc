@@ -0,0 +1,160 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "catch2/catch.hpp"
+#include "zinc/containers/hash_map.h"
+#include "zinc/containers/hash_set.h"
+#include "zinc/containers/vec.h"
+#include "zinc/types/iterators.h"
+#include <string>
+
+TEST_CASE("small vecs stay inline until they outgrow N", "[containers][small]")
+{
+    zinc::SmallVec<int, 8> vec;
+
+    for (auto i : zinc::range(0, 8))
+    {
+        vec.push_back(static_cast<int>(i));
+
+        REQUIRE(vec.using_small());
+    }
+
+    // the ninth element is the first one that doesn't fit
+    vec.push_back(8);
+
+    REQUIRE_FALSE(vec.using_small());
+    REQUIRE(vec.size() == 9);
+
+    for (auto [i, value] : zinc::enumerate(vec))
+    {
+        REQUIRE(value == static_cast<int>(i));
+    }
+}
+
+TEST_CASE("small hash sets stay inline until they outgrow N", "[containers][small]")
+{
+    zinc::SmallHashSet<int, 8> set;
+
+    for (auto i : zinc::range(0, 8))
+    {
+        set.insert(static_cast<int>(i));
+
+        REQUIRE(set.using_small());
+    }
+
+    // fill well past the inline capacity to force a spill
+    for (auto i : zinc::range(8, 100))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    REQUIRE_FALSE(set.using_small());
+    REQUIRE(set.size() == 100);
+
+    for (auto i : zinc::range(0, 100))
+    {
+        REQUIRE(set.contains(static_cast<int>(i)));
+    }
+}
+
+TEST_CASE("small hash maps work with non-trivial values", "[containers][small]")
+{
+    zinc::SmallHashMap<std::string, std::string, 4> map;
+
+    map.emplace("one", "1");
+    map.emplace("two", "2");
+
+    REQUIRE(map.using_small());
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.at("one") == "1");
+    REQUIRE(map.at("two") == "2");
+
+    for (auto i : zinc::range(0, 50))
+    {
+        map.emplace("key-" + std::to_string(i), std::to_string(i));
+    }
+
+    REQUIRE_FALSE(map.using_small());
+    REQUIRE(map.at("one") == "1");
+    REQUIRE(map.at("key-42") == "42");
+}
+
+TEST_CASE("clearing and releasing a small table moves it back inline", "[containers][small]")
+{
+    zinc::SmallHashSet<int, 8> set;
+
+    for (auto i : zinc::range(0, 100))
+    {
+        set.insert(static_cast<int>(i));
+    }
+
+    REQUIRE_FALSE(set.using_small());
+
+    set.clear_and_release();
+    set.insert(1);
+
+    // the inline buffer is dead after the spill, so a released table
+    // re-adopts it instead of going back to the allocator
+    REQUIRE(set.using_small());
+    REQUIRE(set.contains(1));
+}
+
+TEST_CASE("moving a small container spills it safely", "[containers][small]")
+{
+    zinc::SmallHashMap<int, std::string, 8> map;
+
+    map.emplace(1, "one");
+    map.emplace(2, "two");
+
+    REQUIRE(map.using_small());
+
+    // the inline buffer lives inside `map` and can't be stolen: the contents
+    // must survive in the destination on their own
+    auto moved = std::move(map);
+
+    REQUIRE(moved.size() == 2);
+    REQUIRE(moved.at(1) == "one");
+    REQUIRE(moved.at(2) == "two");
+
+    zinc::SmallVec<std::string, 4> vec;
+
+    vec.push_back("a");
+    vec.push_back("b");
+
+    auto moved_vec = std::move(vec);
+
+    REQUIRE(moved_vec.size() == 2);
+    REQUIRE(moved_vec[0] == "a");
+    REQUIRE(moved_vec[1] == "b");
+}
+
+TEST_CASE("copies of small containers are independent", "[containers][small]")
+{
+    zinc::SmallHashSet<int, 8> set;
+
+    set.insert(1);
+    set.insert(2);
+
+    auto copy = set;
+
+    copy.insert(3);
+
+    REQUIRE(set.size() == 2);
+    REQUIRE(copy.size() == 3);
+    REQUIRE(set.using_small());
+}
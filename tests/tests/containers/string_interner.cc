@@ -0,0 +1,87 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/string_interner.h"
+#include "catch2/catch.hpp"
+#include <string>
+#include <vector>
+
+TEST_CASE("interning the same string twice yields the same symbol", "[containers][string_interner]")
+{
+    auto interner = zinc::StringInterner();
+
+    const auto first = interner.intern("identifier");
+    const auto again = interner.intern(std::string("identifier")); // different bytes, same contents
+    const auto other = interner.intern("Identifier");
+
+    REQUIRE(first == again);
+    REQUIRE(first != other);
+    REQUIRE(interner.size() == 2);
+}
+
+TEST_CASE("symbols resolve back to the exact bytes they were made from", "[containers][string_interner]")
+{
+    auto interner = zinc::StringInterner();
+
+    // the source string dies right after interning, the symbol must not care
+    auto symbol = zinc::StringInterner::Symbol{};
+
+    {
+        const auto temporary = std::string("keyword_") + std::to_string(42);
+
+        symbol = interner.intern(temporary);
+    }
+
+    REQUIRE(interner.text_of(symbol) == "keyword_42");
+    REQUIRE(interner.intern("") != symbol);
+    REQUIRE(interner.text_of(interner.intern("")).empty());
+}
+
+TEST_CASE("find probes without growing the table", "[containers][string_interner]")
+{
+    auto interner = zinc::StringInterner();
+    const auto known = interner.intern("while");
+
+    REQUIRE(interner.find("while") == known);
+    REQUIRE(!interner.find("until").has_value());
+    REQUIRE(interner.size() == 1);
+}
+
+TEST_CASE("handed-out views survive arena growth", "[containers][string_interner]")
+{
+    // a tiny chunk size forces the arena through many chunks; every earlier
+    // view has to stay exactly where it was
+    auto interner = zinc::StringInterner(256);
+    auto symbols = std::vector<zinc::StringInterner::Symbol>();
+    const auto early = interner.intern("the very first string");
+    const auto* stable = interner.text_of(early).data();
+
+    for (auto i = 0; i < 10'000; ++i)
+    {
+        symbols.push_back(interner.intern("unique_symbol_" + std::to_string(i)));
+    }
+
+    REQUIRE(interner.text_of(early).data() == stable);
+    REQUIRE(interner.size() == 10'001);
+    REQUIRE(interner.arena_capacity() >= 256);
+
+    for (auto i = 0; i < 10'000; ++i)
+    {
+        REQUIRE(interner.text_of(symbols[static_cast<std::size_t>(i)]) == "unique_symbol_" + std::to_string(i));
+    }
+}
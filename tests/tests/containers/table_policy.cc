@@ -0,0 +1,97 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/table_policy.h"
+#include "catch2/catch.hpp"
+#include "zinc/containers/hash_map.h"
+#include "zinc/containers/hash_set.h"
+#include "zinc/containers/node_hash_map.h"
+#include <string>
+
+TEST_CASE("the default policy is exactly the old global one", "[containers][table_policy]")
+{
+    STATIC_REQUIRE(zinc::DefaultTablePolicy::max_load_factor == 0.72f);
+    STATIC_REQUIRE(zinc::DefaultTablePolicy::growth_factor == 2);
+    STATIC_REQUIRE(zinc::DefaultTablePolicy::min_capacity == 32);
+
+    auto map = zinc::HashMap<int, int>();
+
+    REQUIRE(map.max_load_factor() == 0.72f);
+}
+
+TEST_CASE("a policy pins initial capacity and drives growth", "[containers][table_policy]")
+{
+    // a read-mostly table: half-empty for short probes, pre-sized to skip
+    // the early rehash ladder, and growing 4x when it does outgrow itself
+    using ReadMostly = zinc::TablePolicy<1, 2, 4, 1024>;
+    auto map = zinc::HashMap<int, int, zinc::Hash<int>, zinc::EqualTo<int>, std::allocator<std::pair<const int, int>>,
+        ReadMostly>();
+
+    REQUIRE(map.max_load_factor() == 0.5f);
+
+    map.emplace(1, 1);
+
+    REQUIRE(map.bucket_count() == 1024);
+
+    for (auto i = 0; i < 513; ++i)
+    {
+        map.emplace(i, i);
+    }
+
+    // one growth step at 4x, not two doublings
+    REQUIRE(map.bucket_count() == 4096);
+
+    for (auto i = 0; i < 513; ++i)
+    {
+        REQUIRE(map.at(i) == i);
+    }
+}
+
+TEST_CASE("a dense policy packs sets past the default ceiling", "[containers][table_policy]")
+{
+    using Dense = zinc::TablePolicy<9, 10, 2, 32>;
+    auto set = zinc::HashSet<int, zinc::Hash<int>, zinc::EqualTo<int>, std::allocator<int>, Dense>();
+
+    // 900 into 1024 buckets sits at 0.88 - the default policy would have
+    // doubled at 738
+    for (auto i = 0; i < 900; ++i)
+    {
+        set.emplace(i);
+    }
+
+    REQUIRE(set.size() == 900);
+    REQUIRE(set.bucket_count() == 1024);
+    REQUIRE(set.load_factor() > 0.72f);
+
+    for (auto i = 0; i < 900; ++i)
+    {
+        REQUIRE(set.contains(i));
+    }
+}
+
+TEST_CASE("node maps take a policy too", "[containers][table_policy]")
+{
+    using PreSized = zinc::TablePolicy<72, 100, 2, 256>;
+    auto map = zinc::NodeHashMap<std::string, int, zinc::Hash<std::string>, zinc::EqualTo<std::string>,
+        zinc::PoolAllocator<std::pair<std::string, int>>, PreSized>();
+
+    map.emplace("policy", 1);
+
+    REQUIRE(map.bucket_count() == 256);
+    REQUIRE(map.at("policy") == 1);
+}
@@ -0,0 +1,91 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/containers/vec.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <algorithm>
+#include <string>
+
+TEST_CASE("empty vecs behave", "[containers][vec]")
+{
+    zinc::Vec<int> vec;
+
+    REQUIRE(vec.empty());
+    REQUIRE(vec.size() == 0);
+    REQUIRE(vec.begin() == vec.end());
+}
+
+TEST_CASE("vec pushes stay ordered and contiguous", "[containers][vec]")
+{
+    zinc::Vec<std::string> vec;
+
+    for (auto i : zinc::range(0, 1000))
+    {
+        vec.push_back("value-" + std::to_string(i));
+    }
+
+    REQUIRE(vec.size() == 1000);
+    REQUIRE(vec.front() == "value-0");
+    REQUIRE(vec.back() == "value-999");
+
+    for (auto [i, value] : zinc::enumerate(vec))
+    {
+        REQUIRE(&value == vec.data() + i);
+        REQUIRE(value == "value-" + std::to_string(i));
+    }
+}
+
+TEST_CASE("vec indexing and bounds checking work", "[containers][vec]")
+{
+    zinc::Vec<int> vec = {10, 20, 30};
+
+    REQUIRE(vec[0] == 10);
+    REQUIRE(vec[2] == 30);
+    REQUIRE(vec.at(1) == 20);
+    REQUIRE_THROWS_AS(vec.at(3), std::out_of_range);
+}
+
+TEST_CASE("vec copies and moves preserve contents", "[containers][vec]")
+{
+    zinc::Vec<std::string> vec = {"a", "b", "c"};
+
+    auto copy = vec;
+
+    REQUIRE(copy == vec);
+
+    auto moved = std::move(copy);
+
+    REQUIRE(moved == vec);
+    REQUIRE(copy.empty()); // NOLINT: intentional use-after-move
+}
+
+TEST_CASE("vec resize grows and shrinks from the back", "[containers][vec]")
+{
+    zinc::Vec<int> vec = {1, 2, 3};
+
+    vec.resize(5);
+
+    REQUIRE(vec.size() == 5);
+    REQUIRE(vec[4] == 0);
+
+    vec.resize(1);
+
+    REQUIRE(vec.size() == 1);
+    REQUIRE(vec.front() == 1);
+}
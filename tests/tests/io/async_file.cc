@@ -0,0 +1,134 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/io/async_file.h"
+#include "catch2/catch.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    class TempFile
+    {
+    public:
+        explicit TempFile(std::string_view contents, std::string_view name = "zinc_async_file_test.txt")
+            : path_(std::filesystem::temp_directory_path() / name)
+        {
+            std::ofstream out(path_, std::ios_base::binary | std::ios_base::trunc);
+
+            out << contents;
+        }
+
+        ~TempFile() { std::filesystem::remove(path_); }
+
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+    private:
+        std::filesystem::path path_;
+    };
+
+    zinc::Task<std::string> open_and_read(zinc::AsyncIo& io, std::filesystem::path path)
+    {
+        auto file = co_await zinc::open_file(io, std::move(path));
+
+        co_return co_await file.read_all();
+    }
+} // namespace
+
+TEST_CASE("awaited reads yield exactly the file's bytes", "[io][async_file]")
+{
+    const auto contents = std::string("every byte, asynchronously");
+    TempFile temp(contents);
+    zinc::AsyncIo io;
+
+    REQUIRE(zinc::block_on(open_and_read(io, temp.path())) == contents);
+}
+
+TEST_CASE("files larger than one read chunk reassemble in order", "[io][async_file]")
+{
+    auto contents = std::string();
+
+    // several 64KiB chunks plus a ragged tail
+    for (auto i = 0; i < 200000; ++i)
+    {
+        contents += static_cast<char>('a' + (i % 26));
+    }
+
+    TempFile temp(contents);
+    zinc::AsyncIo io;
+
+    REQUIRE(zinc::block_on(open_and_read(io, temp.path())) == contents);
+}
+
+TEST_CASE("empty files read as empty strings", "[io][async_file]")
+{
+    TempFile temp("");
+    zinc::AsyncIo io;
+
+    REQUIRE(zinc::block_on(open_and_read(io, temp.path())).empty());
+}
+
+TEST_CASE("many files can be in flight on one engine at once", "[io][async_file]")
+{
+    constexpr auto files = 16;
+
+    auto temps = std::vector<TempFile>();
+
+    // reallocation would destroy (and therefore delete) the early files
+    temps.reserve(files);
+
+    for (auto i = 0; i < files; ++i)
+    {
+        temps.emplace_back(std::string(static_cast<std::size_t>(i) * 1000, 'x'),
+            "zinc_async_file_test_" + std::to_string(i) + ".txt");
+    }
+
+    zinc::AsyncIo io;
+    auto lengths = std::vector<std::size_t>(files);
+    auto threads = std::vector<std::thread>();
+
+    for (auto i = 0; i < files; ++i)
+    {
+        threads.emplace_back([&io, &temps, &lengths, i] {
+            lengths[static_cast<std::size_t>(i)] = zinc::block_on(open_and_read(io, temps[static_cast<std::size_t>(i)].path())).size();
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto i = std::size_t{0}; i < files; ++i)
+    {
+        REQUIRE(lengths[i] == i * 1000);
+    }
+}
+
+TEST_CASE("failed opens surface as BadFileOpen through the await", "[io][async_file]")
+{
+    zinc::AsyncIo io;
+
+    REQUIRE_THROWS_AS(zinc::block_on(open_and_read(io, std::filesystem::temp_directory_path())), zinc::BadFileOpen);
+    REQUIRE_THROWS_AS(zinc::block_on(open_and_read(io, "definitely/not/a/real/file.txt")), zinc::BadFileOpen);
+}
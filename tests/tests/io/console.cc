@@ -0,0 +1,93 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/io/console.h"
+#include "catch2/catch.hpp"
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    struct StreamedOnly
+    {
+        int value;
+
+        friend std::ostream& operator<<(std::ostream& out, const StreamedOnly& self)
+        {
+            return out << "<StreamedOnly " << self.value << ">";
+        }
+    };
+
+    template <typename... Args> std::string sprinted(Args&&... args)
+    {
+        std::ostringstream out;
+
+        zinc::sprint(out, std::forward<Args>(args)...);
+
+        return out.str();
+    }
+} // namespace
+
+TEST_CASE("sprint formats arguments back to back", "[io][console]")
+{
+    using namespace std::literals;
+
+    REQUIRE(sprinted("x = "sv, 42, ", done"sv) == "x = 42, done");
+    REQUIRE(sprinted('a', 'b', 'c') == "abc");
+    REQUIRE(sprinted(std::string("owned"), " and literal") == "owned and literal");
+}
+
+TEST_CASE("numbers format like a default ostream would", "[io][console]")
+{
+    REQUIRE(sprinted(0) == "0");
+    REQUIRE(sprinted(-12345) == "-12345");
+    REQUIRE(sprinted(18446744073709551615ULL) == "18446744073709551615");
+    REQUIRE(sprinted(true, ' ', false) == "1 0");
+    REQUIRE(sprinted(2.5) == "2.5");
+}
+
+TEST_CASE("types with only operator<< still print", "[io][console]")
+{
+    REQUIRE(sprinted(StreamedOnly{7}) == "<StreamedOnly 7>");
+    REQUIRE(sprinted("mixed: ", StreamedOnly{1}, ' ', 2) == "mixed: <StreamedOnly 1> 2");
+}
+
+TEST_CASE("format fills placeholders in order", "[io][console]")
+{
+    using namespace std::literals;
+
+    REQUIRE(zinc::format<"x = {}, y = {}">(3, 4.5) == "x = 3, y = 4.5");
+    REQUIRE(zinc::format<"{}{}{}">('a', "bc"sv, 1) == "abc1");
+    REQUIRE(zinc::format<"no placeholders">() == "no placeholders");
+    REQUIRE(zinc::format<"{}">(StreamedOnly{9}) == "<StreamedOnly 9>");
+}
+
+TEST_CASE("lone braces are ordinary characters", "[io][console]")
+{
+    REQUIRE(zinc::format<"json: { \"n\": {} }">(5) == "json: { \"n\": 5 }");
+}
+
+TEST_CASE("compile-time format strings work through sprint", "[io][console]")
+{
+    std::ostringstream out;
+
+    zinc::sprint<"count={} ok={}">(out, 12, true);
+
+    REQUIRE(out.str() == "count=12 ok=1");
+}
@@ -0,0 +1,187 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/io/file.h"
+#include "catch2/catch.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+namespace
+{
+    // a file that exists for one test and cleans up after itself
+    class TempFile
+    {
+    public:
+        explicit TempFile(std::string_view contents)
+            : path_(std::filesystem::temp_directory_path() / "zinc_mapped_file_test.txt")
+        {
+            std::ofstream out(path_, std::ios_base::binary | std::ios_base::trunc);
+
+            out << contents;
+        }
+
+        ~TempFile() { std::filesystem::remove(path_); }
+
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+    private:
+        std::filesystem::path path_;
+    };
+} // namespace
+
+TEST_CASE("mapped files view the exact bytes on disk", "[io][file]")
+{
+    TempFile temp("hello, mapped\nworld\n");
+    zinc::MappedFile file(temp.path());
+
+    REQUIRE(file.size() == 20);
+    REQUIRE(file.view() == "hello, mapped\nworld\n");
+    REQUIRE(file.bytes().size() == file.size());
+    REQUIRE(file.bytes()[0] == std::byte{'h'});
+}
+
+TEST_CASE("empty files map as empty, not as errors", "[io][file]")
+{
+    TempFile temp("");
+    zinc::MappedFile file(temp.path());
+
+    REQUIRE(file.empty());
+    REQUIRE(file.size() == 0);
+    REQUIRE(file.view().empty());
+}
+
+TEST_CASE("mappings move without invalidating the view", "[io][file]")
+{
+    TempFile temp("moved contents");
+    zinc::MappedFile file(temp.path());
+
+    const auto* before = file.data();
+    auto moved = std::move(file);
+
+    REQUIRE(moved.data() == before);
+    REQUIRE(moved.view() == "moved contents");
+    REQUIRE(file.empty()); // NOLINT: moved-from state is defined as empty
+}
+
+TEST_CASE("access hints are accepted for any live mapping", "[io][file]")
+{
+    TempFile temp("some contents to advise about");
+    auto file = zinc::map_file(temp.path(), zinc::MappedAccess::sequential);
+
+    file.advise(zinc::MappedAccess::random);
+    file.advise(zinc::MappedAccess::normal);
+
+    REQUIRE(file.view() == "some contents to advise about");
+}
+
+TEST_CASE("gather-writes land back to back with nothing in between", "[io][file]")
+{
+    TempFile temp("header|");
+    auto file = zinc::open_file(temp.path());
+
+    const auto body = std::string_view("body|");
+    const auto trailer = std::string_view("trailer");
+    const std::span<const std::byte> pieces[] = {
+        std::as_bytes(std::span(body)),
+        std::span<const std::byte>{}, // empty pieces are legal and write nothing
+        std::as_bytes(std::span(trailer)),
+    };
+
+    file.write_all(pieces);
+
+    REQUIRE(file.content() == "header|body|trailer");
+    REQUIRE(zinc::read_file(temp.path()) == "header|body|trailer");
+}
+
+TEST_CASE("gather-writes chain like the other write operations", "[io][file]")
+{
+    TempFile temp("");
+    auto file = zinc::open_file(temp.path());
+
+    const auto a = std::string_view("one ");
+    const auto b = std::string_view("two");
+    const std::span<const std::byte> first[] = {std::as_bytes(std::span(a))};
+    const std::span<const std::byte> second[] = {std::as_bytes(std::span(b))};
+
+    file.write_all(first).write_all(second);
+
+    REQUIRE(file.content() == "one two");
+}
+
+TEST_CASE("mapping a directory or a missing file throws", "[io][file]")
+{
+    REQUIRE_THROWS_AS(zinc::MappedFile(std::filesystem::temp_directory_path()), zinc::BadFileOpen);
+    REQUIRE_THROWS_AS(zinc::MappedFile("/definitely/not/a/real/file"), zinc::BadFileOpen);
+}
+
+TEST_CASE("batched appends stay in memory until flush", "[io][file]")
+{
+    TempFile temp("start|");
+    auto file = zinc::open_file(temp.path());
+    auto batch = file.batched();
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        batch.append(i % 10);
+    }
+
+    // nothing has hit the file yet, only the batch buffer
+    REQUIRE(batch.pending() == 100);
+    REQUIRE(zinc::read_file(temp.path()) == "start|");
+
+    batch.flush();
+
+    REQUIRE(batch.pending() == 0);
+    REQUIRE(file.content().size() == 106);
+    REQUIRE(zinc::read_file(temp.path()).size() == 106);
+}
+
+TEST_CASE("batches commit on scope exit", "[io][file]")
+{
+    TempFile temp("");
+    auto file = zinc::open_file(temp.path());
+
+    {
+        auto batch = file.batched();
+
+        batch.append("checkpoint ").append(42).append('\n');
+    }
+
+    REQUIRE(zinc::read_file(temp.path()) == "checkpoint 42\n");
+}
+
+TEST_CASE("moved-from batches commit nothing", "[io][file]")
+{
+    TempFile temp("");
+    auto file = zinc::open_file(temp.path());
+
+    {
+        auto batch = file.batched();
+
+        batch.append("once");
+
+        auto moved = std::move(batch);
+
+        REQUIRE(moved.pending() == 4);
+    }
+
+    REQUIRE(zinc::read_file(temp.path()) == "once");
+}
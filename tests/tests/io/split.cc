@@ -0,0 +1,103 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/io/split.h"
+#include "catch2/catch.hpp"
+#include "zinc/types/iterators.h"
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string_view> collect(const zinc::SplitAdapter<char>& adapter)
+    {
+        std::vector<std::string_view> out;
+
+        for (auto piece : adapter)
+        {
+            out.push_back(piece);
+        }
+
+        return out;
+    }
+} // namespace
+
+TEST_CASE("split yields views between every delimiter", "[io][split]")
+{
+    using namespace std::literals;
+
+    const auto tokens = collect(zinc::split("one,two,three"sv, ','));
+
+    REQUIRE(tokens == std::vector{"one"sv, "two"sv, "three"sv});
+}
+
+TEST_CASE("split keeps empty tokens, including trailing ones", "[io][split]")
+{
+    using namespace std::literals;
+
+    REQUIRE(collect(zinc::split("a,,b,"sv, ',')) == std::vector{"a"sv, ""sv, "b"sv, ""sv});
+    REQUIRE(collect(zinc::split(""sv, ',')) == std::vector{""sv});
+    REQUIRE(collect(zinc::split("no delimiters"sv, ',')) == std::vector{"no delimiters"sv});
+}
+
+TEST_CASE("split tokens are views into the original buffer", "[io][split]")
+{
+    using namespace std::literals;
+
+    const auto text = "x|y|z"sv;
+
+    for (auto token : zinc::split(text, '|'))
+    {
+        REQUIRE(token.data() >= text.data());
+        REQUIRE(token.data() + token.size() <= text.data() + text.size());
+    }
+}
+
+TEST_CASE("lines swallows the trailing newline", "[io][split]")
+{
+    using namespace std::literals;
+
+    REQUIRE(collect(zinc::lines("first\nsecond\nthird\n"sv)) == std::vector{"first"sv, "second"sv, "third"sv});
+    REQUIRE(collect(zinc::lines("no trailing newline"sv)) == std::vector{"no trailing newline"sv});
+    REQUIRE(collect(zinc::lines("\n\n"sv)) == std::vector{""sv, ""sv});
+    REQUIRE(collect(zinc::lines("\n"sv)) == std::vector{""sv});
+    REQUIRE(collect(zinc::lines(""sv)).empty());
+}
+
+TEST_CASE("split composes with enumerate", "[io][split]")
+{
+    using namespace std::literals;
+
+    const auto fields = zinc::split("f0,f1,f2,f3"sv, ',');
+    auto count = std::size_t{0};
+
+    for (auto [i, field] : zinc::enumerate(fields))
+    {
+        // built with += because `operator+(const char*, std::string&&)` trips
+        // GCC 12's -Werror=restrict false positive in optimized builds
+        auto expected = std::string("f");
+
+        expected += std::to_string(i);
+
+        REQUIRE(field == expected);
+
+        ++count;
+    }
+
+    REQUIRE(count == 4);
+}
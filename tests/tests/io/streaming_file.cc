@@ -0,0 +1,124 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/io/streaming_file.h"
+#include "catch2/catch.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+
+namespace
+{
+    class TempFile
+    {
+    public:
+        explicit TempFile(std::string_view contents)
+            : path_(std::filesystem::temp_directory_path() / "zinc_streaming_file_test.txt")
+        {
+            std::ofstream out(path_, std::ios_base::binary | std::ios_base::trunc);
+
+            out << contents;
+        }
+
+        ~TempFile() { std::filesystem::remove(path_); }
+
+        [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+    private:
+        std::filesystem::path path_;
+    };
+
+    std::string drain(zinc::StreamingFile& file)
+    {
+        std::string out;
+
+        for (auto chunk = file.next(); !chunk.empty(); chunk = file.next())
+        {
+            out.append(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+        }
+
+        return out;
+    }
+} // namespace
+
+TEST_CASE("chunks reassemble into the exact file contents", "[io][streaming_file]")
+{
+    std::string contents;
+
+    for (auto i = 0; i < 1000; ++i)
+    {
+        contents += "line " + std::to_string(i) + "\n";
+    }
+
+    TempFile temp(contents);
+    zinc::StreamingFile file(temp.path(), 64);
+
+    REQUIRE(file.chunk_size() == 64);
+    REQUIRE(drain(file) == contents);
+    REQUIRE(file.exhausted());
+}
+
+TEST_CASE("files that fit in one chunk come back whole", "[io][streaming_file]")
+{
+    TempFile temp("small enough");
+    zinc::StreamingFile file(temp.path());
+
+    const auto chunk = file.next();
+
+    REQUIRE(std::string_view(reinterpret_cast<const char*>(chunk.data()), chunk.size()) == "small enough");
+    REQUIRE(file.next().empty());
+}
+
+TEST_CASE("chunk-aligned files don't produce a phantom chunk", "[io][streaming_file]")
+{
+    TempFile temp(std::string(128, 'x'));
+    zinc::StreamingFile file(temp.path(), 64);
+
+    REQUIRE(file.next().size() == 64);
+    REQUIRE(file.next().size() == 64);
+    REQUIRE(file.next().empty());
+    REQUIRE(file.exhausted());
+}
+
+TEST_CASE("empty files are exhausted from the first chunk", "[io][streaming_file]")
+{
+    TempFile temp("");
+    zinc::StreamingFile file(temp.path());
+
+    REQUIRE(file.next().empty());
+}
+
+TEST_CASE("streams move with their in-flight read intact", "[io][streaming_file]")
+{
+    TempFile temp(std::string(100, 'a') + std::string(100, 'b'));
+    zinc::StreamingFile file(temp.path(), 100);
+
+    auto moved = std::move(file);
+
+    REQUIRE(moved.next().size() == 100);
+    REQUIRE(moved.next()[0] == std::byte{'b'});
+    REQUIRE(moved.next().empty());
+}
+
+TEST_CASE("streaming a directory or a missing file throws", "[io][streaming_file]")
+{
+    REQUIRE_THROWS_AS(zinc::StreamingFile(std::filesystem::temp_directory_path()), zinc::BadFileOpen);
+    REQUIRE_THROWS_AS(zinc::StreamingFile("/definitely/not/a/real/file"), zinc::BadFileOpen);
+}
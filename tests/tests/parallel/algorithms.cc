@@ -0,0 +1,152 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/parallel/algorithms.h"
+#include "zinc/types/iterators/range.h"
+#include "catch2/catch.hpp"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+TEST_CASE("parallel_for_each visits every element exactly once", "[parallel][algorithms]")
+{
+    constexpr auto count = std::size_t{100000};
+
+    zinc::ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(count);
+
+    zinc::parallel_for_each(pool, zinc::range_of(std::size_t{0}, count), [&visits](std::size_t i) {
+        ++visits[i];
+    });
+
+    for (const auto& visit : visits)
+    {
+        REQUIRE(visit == 1);
+    }
+}
+
+TEST_CASE("parallel_for_each handles small and empty ranges inline", "[parallel][algorithms]")
+{
+    zinc::ThreadPool pool(4);
+    auto sum = 0;
+
+    zinc::parallel_for_each(pool, zinc::range_of(0, 10), [&sum](int i) {
+        // safe without atomics: small ranges never leave the calling thread
+        sum += i;
+    });
+
+    REQUIRE(sum == 45);
+
+    zinc::parallel_for_each(pool, zinc::range_of(0, 0), [&sum](int) {
+        ++sum;
+    });
+
+    REQUIRE(sum == 45);
+}
+
+TEST_CASE("parallel_transform writes each result in its place", "[parallel][algorithms]")
+{
+    constexpr auto count = std::size_t{50000};
+
+    zinc::ThreadPool pool(4);
+    std::vector<std::size_t> doubled(count);
+
+    const auto end = zinc::parallel_transform(pool,
+        zinc::range_of(std::size_t{0}, count),
+        doubled.begin(),
+        [](std::size_t i) {
+            return i * 2;
+        });
+
+    REQUIRE(end == doubled.end());
+
+    for (auto i = std::size_t{0}; i < count; ++i)
+    {
+        REQUIRE(doubled[i] == i * 2);
+    }
+}
+
+TEST_CASE("parallel_reduce folds to the same answer as a serial loop", "[parallel][algorithms]")
+{
+    constexpr auto count = std::size_t{100000};
+
+    zinc::ThreadPool pool(4);
+
+    const auto sum = zinc::parallel_reduce(pool,
+        zinc::range_of(std::size_t{1}, count + 1),
+        std::size_t{0},
+        [](std::size_t accumulator, std::size_t i) {
+            return accumulator + i;
+        });
+
+    REQUIRE(sum == count * (count + 1) / 2);
+}
+
+TEST_CASE("parallel_reduce folds init in exactly once", "[parallel][algorithms]")
+{
+    constexpr auto count = std::size_t{100000};
+
+    zinc::ThreadPool pool(4);
+
+    // if init leaked into every chunk, the extra 7s would show in the sum
+    const auto total = zinc::parallel_reduce(pool,
+        zinc::range_of(std::size_t{0}, count),
+        std::size_t{7},
+        [](std::size_t accumulator, std::size_t i) {
+            return accumulator + i;
+        });
+
+    REQUIRE(total == count * (count - 1) / 2 + 7);
+}
+
+TEST_CASE("nested parallel calls inside a worker don't deadlock", "[parallel][algorithms]")
+{
+    constexpr auto count = std::size_t{20000};
+
+    zinc::ThreadPool pool(2);
+    std::atomic<std::size_t> visited = 0;
+
+    zinc::parallel_for_each(pool, zinc::range_of(std::size_t{0}, count), [&pool, &visited](std::size_t) {
+        // runs inline because the caller is already one of the pool's workers
+        zinc::parallel_for_each(pool, zinc::range_of(0, 2), [&visited](int) {
+            ++visited;
+        });
+    });
+
+    REQUIRE(visited == count * 2);
+}
+
+TEST_CASE("the pool-less overloads run on the shared pool", "[parallel][algorithms]")
+{
+    constexpr auto count = std::size_t{50000};
+
+    std::atomic<std::size_t> visited = 0;
+
+    zinc::parallel_for_each(zinc::range_of(std::size_t{0}, count), [&visited](std::size_t) {
+        ++visited;
+    });
+
+    REQUIRE(visited == count);
+
+    const auto sum = zinc::parallel_reduce(zinc::range_of(std::size_t{0}, count), std::size_t{0},
+        [](std::size_t accumulator, std::size_t i) {
+            return accumulator + i;
+        });
+
+    REQUIRE(sum == count * (count - 1) / 2);
+}
@@ -0,0 +1,117 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/parallel/thread_pool.h"
+#include "catch2/catch.hpp"
+#include <atomic>
+#include <latch>
+
+TEST_CASE("every submitted task runs exactly once", "[parallel][thread_pool]")
+{
+    constexpr auto tasks = 1000;
+
+    std::atomic<int> ran = 0;
+    std::latch done(tasks);
+
+    {
+        zinc::ThreadPool pool(4);
+
+        REQUIRE(pool.worker_count() == 4);
+
+        for (auto i = 0; i < tasks; ++i)
+        {
+            pool.submit([&ran, &done] {
+                ++ran;
+                done.count_down();
+            });
+        }
+
+        done.wait();
+    }
+
+    REQUIRE(ran == tasks);
+}
+
+TEST_CASE("the destructor finishes outstanding tasks before joining", "[parallel][thread_pool]")
+{
+    constexpr auto tasks = 200;
+
+    std::atomic<int> ran = 0;
+
+    {
+        zinc::ThreadPool pool(2);
+
+        for (auto i = 0; i < tasks; ++i)
+        {
+            pool.submit([&ran] {
+                ++ran;
+            });
+        }
+
+        // no wait: tearing the pool down is the synchronization
+    }
+
+    REQUIRE(ran == tasks);
+}
+
+TEST_CASE("tasks can fan out into subtasks from inside a worker", "[parallel][thread_pool]")
+{
+    constexpr auto parents = 16;
+    constexpr auto children = 32;
+
+    std::atomic<int> ran = 0;
+    std::atomic<bool> saw_worker_thread = true;
+    std::latch done(parents * children);
+
+    {
+        zinc::ThreadPool pool(4);
+
+        for (auto parent = 0; parent < parents; ++parent)
+        {
+            pool.submit([&pool, &ran, &saw_worker_thread, &done] {
+                // Catch2 assertions aren't thread-safe, so record and check later
+                if (!pool.on_worker_thread())
+                {
+                    saw_worker_thread = false;
+                }
+
+                for (auto child = 0; child < children; ++child)
+                {
+                    pool.submit([&ran, &done] {
+                        ++ran;
+                        done.count_down();
+                    });
+                }
+            });
+        }
+
+        done.wait();
+    }
+
+    REQUIRE(ran == parents * children);
+    REQUIRE(saw_worker_thread);
+}
+
+TEST_CASE("the shared pool exists and outside threads aren't workers", "[parallel][thread_pool]")
+{
+    auto& pool = zinc::ThreadPool::shared();
+
+    REQUIRE(pool.worker_count() >= 1);
+    REQUIRE(&pool == &zinc::ThreadPool::shared());
+    REQUIRE(!pool.on_worker_thread());
+}
@@ -0,0 +1,185 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/types/allocators/arena.h"
+#include "catch2/catch.hpp"
+#include "zinc/containers/hash_map.h"
+#include "zinc/containers/node_hash_map.h"
+#include "zinc/containers/vec.h"
+#include "zinc/types/allocators/pool.h"
+#include "zinc/types/iterators.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+
+static_assert(zinc::Allocator<zinc::ArenaAllocator<int>, int>,
+    "ArenaAllocator must satisfy the same concept every container checks");
+
+static_assert(zinc::Allocator<zinc::PoolAllocator<int>, int>,
+    "PoolAllocator must satisfy the same concept every container checks");
+
+TEST_CASE("arenas bump through chunks and hand out aligned storage", "[types][allocators]")
+{
+    zinc::Arena arena(1024);
+    zinc::ArenaAllocator<std::uint64_t> alloc(arena);
+
+    for ([[maybe_unused]] auto i : zinc::range(0, 1000))
+    {
+        auto* p = alloc.allocate(1);
+
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p) % alignof(std::uint64_t) == 0);
+
+        *p = 42;
+    }
+
+    // ~8KB of u64s through 1KB chunks
+    REQUIRE(arena.capacity() >= 8000);
+}
+
+TEST_CASE("arena reset re-uses the chunks it already owns", "[types][allocators]")
+{
+    zinc::Arena arena(1024);
+    zinc::ArenaAllocator<int> alloc(arena);
+
+    for ([[maybe_unused]] auto i : zinc::range(0, 1000))
+    {
+        (void)alloc.allocate(1);
+    }
+
+    const auto before = arena.capacity();
+
+    arena.reset();
+
+    for ([[maybe_unused]] auto i : zinc::range(0, 1000))
+    {
+        (void)alloc.allocate(1);
+    }
+
+    REQUIRE(arena.capacity() == before);
+}
+
+TEST_CASE("requests bigger than a chunk get their own", "[types][allocators]")
+{
+    zinc::Arena arena(64);
+    zinc::ArenaAllocator<std::byte> alloc(arena);
+
+    auto* small = alloc.allocate(8);
+    auto* large = alloc.allocate(4096);
+
+    REQUIRE(small != nullptr);
+    REQUIRE(large != nullptr);
+    REQUIRE(arena.capacity() >= 4096 + 64);
+}
+
+TEST_CASE("containers drop into an arena directly", "[types][allocators]")
+{
+    zinc::Arena arena;
+
+    {
+        zinc::HashMap<int, int, zinc::Hash<int>, zinc::EqualTo<int>, zinc::ArenaAllocator<std::pair<const int, int>>>
+            map(32, zinc::ArenaAllocator<std::pair<const int, int>>(arena));
+
+        for (auto i : zinc::range(0, 500))
+        {
+            map.emplace(static_cast<int>(i), static_cast<int>(i) * 2);
+        }
+
+        REQUIRE(map.size() == 500);
+        REQUIRE(map.at(137) == 274);
+
+        zinc::Vec<int, zinc::ArenaAllocator<int>> vec(std::size_t{0}, zinc::ArenaAllocator<int>{arena});
+
+        for (auto i : zinc::range(0, 500))
+        {
+            vec.push_back(static_cast<int>(i));
+        }
+
+        REQUIRE(vec.size() == 500);
+    }
+
+    // everything above came from the arena; one reset gives it all back
+    arena.reset();
+
+    REQUIRE(arena.capacity() > 0);
+}
+
+TEST_CASE("pools re-use freed nodes instead of going back to the heap", "[types][allocators]")
+{
+    zinc::PoolAllocator<std::uint64_t> alloc;
+
+    auto* first = alloc.allocate(1);
+    *first = 42;
+    alloc.deallocate(first, 1);
+
+    // the free list hands the same node straight back
+    auto* second = alloc.allocate(1);
+
+    REQUIRE(second == first);
+
+    alloc.deallocate(second, 1);
+}
+
+TEST_CASE("rebound pool copies share the pool", "[types][allocators]")
+{
+    zinc::PoolAllocator<std::uint64_t> alloc;
+    zinc::AllocRebind<decltype(alloc), std::uint32_t> rebound(alloc);
+
+    REQUIRE(alloc == rebound);
+
+    // a rebound request of the pool's exact node size still comes from the pool
+    auto* pair = rebound.allocate(2);
+    auto* node = alloc.allocate(1);
+
+    REQUIRE(pair != nullptr);
+    REQUIRE(node != nullptr);
+
+    rebound.deallocate(pair, 2);
+    alloc.deallocate(node, 1);
+}
+
+TEST_CASE("node maps churn through a pool without leaking", "[types][allocators]")
+{
+    zinc::NodeHashMap<int, std::string> map;
+
+    for (auto i : zinc::range(0, 2000))
+    {
+        map.emplace(static_cast<int>(i), std::to_string(i));
+    }
+
+    for (auto i : zinc::range(0, 2000))
+    {
+        if (i % 2 == 0)
+        {
+            map.erase(static_cast<int>(i));
+        }
+    }
+
+    // every erased node is back on the free list, so re-inserting the same
+    // count shouldn't need new chunks
+    for (auto i : zinc::range(0, 2000))
+    {
+        if (i % 2 == 0)
+        {
+            map.emplace(static_cast<int>(i), std::to_string(i * 3));
+        }
+    }
+
+    REQUIRE(map.size() == 2000);
+    REQUIRE(map.at(100) == "300");
+    REQUIRE(map.at(101) == "101");
+}
@@ -0,0 +1,99 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/types/functors/hash.h"
+#include "catch2/catch.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+TEST_CASE("hash_bytes is deterministic and length-sensitive", "[types][hash]")
+{
+    // every interesting length bucket: empty, tiny, 4..16, mid-loop, and
+    // long enough to go around the 48-byte bulk loop several times
+    const auto text = std::string(200, 'u');
+
+    for (const auto length : {std::size_t{0}, std::size_t{1}, std::size_t{3}, std::size_t{4}, std::size_t{11},
+             std::size_t{16}, std::size_t{17}, std::size_t{48}, std::size_t{49}, std::size_t{200}})
+    {
+        REQUIRE(zinc::hash_bytes(text.data(), length) == zinc::hash_bytes(text.data(), length));
+    }
+
+    REQUIRE(zinc::hash_bytes(text.data(), 48) != zinc::hash_bytes(text.data(), 49));
+}
+
+TEST_CASE("hash_bytes spreads single-byte differences", "[types][hash]")
+{
+    auto url = std::string("https://example.com/some/fairly/long/resource/path?q=zinc&page=3");
+    auto seen = std::unordered_set<std::size_t>();
+
+    seen.insert(zinc::hash_bytes(url.data(), url.size()));
+
+    for (auto i = std::size_t{0}; i < url.size(); ++i)
+    {
+        const auto original = url[i];
+
+        url[i] = (original == 'x') ? 'y' : 'x';
+        seen.insert(zinc::hash_bytes(url.data(), url.size()));
+        url[i] = original;
+    }
+
+    // one flipped byte anywhere in the key changes the hash
+    REQUIRE(seen.size() == url.size() + 1);
+}
+
+TEST_CASE("Hash agrees across string, view and C-string probes", "[types][hash]")
+{
+    const auto owning = std::string("heterogeneous lookup key");
+    const auto view = std::string_view(owning);
+    const auto hasher = zinc::Hash<std::string>();
+
+    REQUIRE(hasher(owning) == hasher(view));
+    REQUIRE(hasher(owning) == hasher("heterogeneous lookup key"));
+    REQUIRE(hasher(owning) == zinc::Hash<std::string_view>()(view));
+    REQUIRE(hasher(owning) == zinc::hash_bytes(owning.data(), owning.size()));
+}
+
+TEST_CASE("Hash still satisfies HashFn and defers to std::hash elsewhere", "[types][hash]")
+{
+    STATIC_REQUIRE(zinc::HashFn<zinc::Hash<std::string>, std::string>);
+    STATIC_REQUIRE(zinc::HashFn<zinc::Hash<int>, int>);
+
+    // types without a zinc specialization still go through std::hash
+    REQUIRE(zinc::Hash<double>()(42.0) == std::hash<double>()(42.0));
+}
+
+TEST_CASE("Hash mixes integers instead of passing them through", "[types][hash]")
+{
+    // usable at compile time, and definitely not the identity
+    STATIC_REQUIRE(zinc::Hash<std::uint64_t>()(1) != 1);
+    STATIC_REQUIRE(zinc::Hash<int>()(7) == zinc::Hash<int>()(7));
+
+    // sequential IDs land in distinct *low bits*: masking the hash down to a
+    // slot index (what the tables do) must not recreate the dense cluster
+    auto low_bits = std::unordered_set<std::size_t>();
+
+    for (auto id = std::uint64_t{0}; id < 1024; ++id)
+    {
+        low_bits.insert(zinc::Hash<std::uint64_t>()(id) & 4095U);
+    }
+
+    // a few collisions in a 1024-into-4096 mask are expected, clusters aren't
+    REQUIRE(low_bits.size() > 850);
+}
@@ -0,0 +1,122 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/types/iterators.h"
+#include "catch2/catch.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+TEST_CASE("zip walks ranges in lockstep and stops at the shortest", "[types][iterators]")
+{
+    const auto numbers = std::vector<int>{1, 2, 3, 4, 5};
+    const auto names = std::vector<std::string>{"one", "two", "three"};
+    auto seen = std::vector<std::pair<int, std::string>>();
+
+    for (auto [number, name] : zinc::zip(numbers, names))
+    {
+        seen.emplace_back(number, name);
+    }
+
+    REQUIRE(seen.size() == 3);
+    REQUIRE(seen[0] == std::pair<int, std::string>{1, "one"});
+    REQUIRE(seen[2] == std::pair<int, std::string>{3, "three"});
+}
+
+TEST_CASE("zip_mut writes through to the underlying ranges", "[types][iterators]")
+{
+    auto lhs = std::vector<int>{1, 2, 3, 4};
+    const auto rhs = std::vector<int>{10, 20, 30, 40};
+
+    for (auto [out, in] : zinc::zip_mut(lhs, rhs))
+    {
+        out += in;
+    }
+
+    REQUIRE(lhs == std::vector<int>{11, 22, 33, 44});
+}
+
+TEST_CASE("zip composes with enumerate", "[types][iterators]")
+{
+    const auto lhs = std::array<int, 3>{2, 4, 6};
+    const auto rhs = std::array<int, 3>{3, 5, 7};
+    const auto zipped = zinc::zip(lhs, rhs);
+
+    for (auto [i, pair] : zinc::enumerate(zipped))
+    {
+        auto [a, b] = pair;
+
+        REQUIRE(a == lhs[i]);
+        REQUIRE(b == rhs[i]);
+    }
+}
+
+TEST_CASE("chunks_of yields full blocks and a remainder tail", "[types][iterators]")
+{
+    auto values = std::vector<int>();
+
+    for (auto i = 0; i < 19; ++i)
+    {
+        values.push_back(i);
+    }
+
+    const auto blocks = zinc::chunks_of<8>(values);
+    auto sum = 0;
+    auto block_count = std::size_t{0};
+
+    for (auto block : blocks)
+    {
+        STATIC_REQUIRE(std::is_same_v<decltype(block), std::span<const int, 8>>);
+
+        for (auto value : block)
+        {
+            sum += value;
+        }
+
+        ++block_count;
+    }
+
+    REQUIRE(block_count == 2);
+    REQUIRE(blocks.block_count() == 2);
+    REQUIRE(blocks.remainder().size() == 3);
+
+    for (auto value : blocks.remainder())
+    {
+        sum += value;
+    }
+
+    REQUIRE(sum == (18 * 19) / 2);
+}
+
+TEST_CASE("chunks_of_mut covers every element exactly once", "[types][iterators]")
+{
+    auto values = std::vector<int>(16, 1);
+    const auto blocks = zinc::chunks_of_mut<4>(values);
+
+    for (auto block : blocks)
+    {
+        for (auto& value : block)
+        {
+            value += 1;
+        }
+    }
+
+    // 16 is an exact multiple, nothing left over
+    REQUIRE(blocks.remainder().empty());
+    REQUIRE(std::count(values.begin(), values.end(), 2) == 16);
+}
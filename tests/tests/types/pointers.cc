@@ -0,0 +1,118 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/types/pointers.h"
+#include "catch2/catch.hpp"
+#include "zinc/util/uninitialized.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace
+{
+    struct ListNode
+    {
+        std::uint64_t value;
+        zinc::OffsetPtr<ListNode> next;
+    };
+} // namespace
+
+TEST_CASE("OffsetPtr is a 4-byte Pointerlike", "[types][pointers]")
+{
+    STATIC_REQUIRE(zinc::Pointerlike<zinc::OffsetPtr<int>>);
+    STATIC_REQUIRE(sizeof(zinc::OffsetPtr<int>) == sizeof(std::uint32_t));
+
+    // the links halve, so the node itself shrinks
+    STATIC_REQUIRE(sizeof(ListNode) == 16);
+
+    // rebinding works through pointer_traits like any fancy pointer
+    STATIC_REQUIRE(
+        std::same_as<zinc::PointerTraits<zinc::OffsetPtr<int>>::rebind<long>, zinc::OffsetPtr<long>>);
+
+    // re-deriving the offset on copy means it is *not* trivially relocatable
+    STATIC_REQUIRE(!zinc::is_trivially_relocatable<zinc::OffsetPtr<int>>);
+}
+
+TEST_CASE("OffsetPtr points, dereferences and nulls like a pointer", "[types][pointers]")
+{
+    auto value = 42;
+    auto ptr = zinc::OffsetPtr<int>(&value);
+
+    REQUIRE(ptr);
+    REQUIRE(*ptr == 42);
+    REQUIRE(ptr.get() == &value);
+    REQUIRE(ptr == zinc::PointerTraits<zinc::OffsetPtr<int>>::pointer_to(value));
+    REQUIRE(std::to_address(ptr) == &value);
+
+    *ptr = 7;
+
+    REQUIRE(value == 7);
+
+    ptr = nullptr;
+
+    REQUIRE(!ptr);
+    REQUIRE(ptr == nullptr);
+    REQUIRE(ptr.get() == nullptr);
+}
+
+TEST_CASE("OffsetPtr arithmetic walks arrays", "[types][pointers]")
+{
+    int values[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    auto first = zinc::OffsetPtr<int>(values);
+    auto last = zinc::OffsetPtr<int>(values + 8);
+
+    REQUIRE(last - first == 8);
+    REQUIRE(first[3] == 3);
+    REQUIRE(*(first + 5) == 5);
+    REQUIRE(first < last);
+
+    auto sum = 0;
+
+    for (auto it = first; it != last; ++it)
+    {
+        sum += *it;
+    }
+
+    REQUIRE(sum == 28);
+}
+
+TEST_CASE("OffsetPtr links survive the whole block moving", "[types][pointers]")
+{
+    // a three-node list built inside one buffer, linked self-relatively
+    alignas(ListNode) std::byte original[sizeof(ListNode) * 3];
+    auto* nodes = reinterpret_cast<ListNode*>(original);
+
+    std::construct_at(nodes + 0, ListNode{.value = 1, .next = nodes + 1});
+    std::construct_at(nodes + 1, ListNode{.value = 2, .next = nodes + 2});
+    std::construct_at(nodes + 2, ListNode{.value = 3, .next = nullptr});
+
+    // bytewise-copy the whole block somewhere else, as a mapped or
+    // relocated segment would
+    alignas(ListNode) std::byte moved[sizeof(original)];
+
+    std::memcpy(moved, original, sizeof(original));
+
+    auto sum = std::uint64_t{0};
+
+    for (auto node = zinc::OffsetPtr<ListNode>(reinterpret_cast<ListNode*>(moved)); node; node = node->next)
+    {
+        sum += node->value;
+    }
+
+    REQUIRE(sum == 6);
+}
@@ -0,0 +1,80 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/types/storage.h"
+#include "catch2/catch.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+TEST_CASE("StorageFor is exactly a T's size and alignment", "[types][storage]")
+{
+    STATIC_REQUIRE(sizeof(zinc::StorageFor<std::uint64_t>) == sizeof(std::uint64_t));
+    STATIC_REQUIRE(alignof(zinc::StorageFor<std::uint64_t>) == alignof(std::uint64_t));
+    STATIC_REQUIRE(sizeof(zinc::StorageFor<std::string>) == sizeof(std::string));
+    STATIC_REQUIRE(alignof(zinc::StorageFor<std::string>) == alignof(std::string));
+
+    zinc::StorageFor<std::string> raw;
+
+    std::construct_at(raw.as(), "built in raw storage");
+
+    REQUIRE(*raw.as() == "built in raw storage");
+
+    std::destroy_at(raw.as());
+}
+
+TEST_CASE("CacheAligned neighbors never share a line", "[types][storage]")
+{
+    STATIC_REQUIRE(alignof(zinc::CacheAligned<int>) == zinc::cache_line_size);
+    STATIC_REQUIRE(sizeof(zinc::CacheAligned<int>) % zinc::cache_line_size == 0);
+
+    zinc::CacheAligned<std::atomic<int>> counters[4];
+
+    for (auto i = 1; i < 4; ++i)
+    {
+        const auto* previous = reinterpret_cast<const std::byte*>(&counters[i - 1].value);
+        const auto* current = reinterpret_cast<const std::byte*>(&counters[i].value);
+
+        REQUIRE(static_cast<std::size_t>(current - previous) >= zinc::cache_line_size);
+    }
+
+    counters[0].value += 1;
+
+    REQUIRE(counters[0].value == 1);
+}
+
+TEST_CASE("CacheAligned forwards constructor arguments", "[types][storage]")
+{
+    const auto wrapped = zinc::CacheAligned<std::string>(std::size_t{5}, 'z');
+
+    REQUIRE(wrapped.value == "zzzzz");
+}
+
+TEST_CASE("Padded separates array neighbors without raising alignment", "[types][storage]")
+{
+    STATIC_REQUIRE(alignof(zinc::Padded<int>) == alignof(int));
+    STATIC_REQUIRE(sizeof(zinc::Padded<int>) % zinc::cache_line_size == 0);
+
+    // a type already a whole number of lines picks up no extra padding
+    STATIC_REQUIRE(sizeof(zinc::Padded<zinc::CacheAligned<int>>) == sizeof(zinc::CacheAligned<int>));
+
+    const auto padded = zinc::Padded<std::string>("forwarded");
+
+    REQUIRE(padded.value == "forwarded");
+}
@@ -0,0 +1,116 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/util/instrument.h"
+#include "catch2/catch.hpp"
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// the registry is process-wide and sites never reset, so every site in this
+// file gets a unique name and the assertions only ever look at exact totals
+
+namespace
+{
+    void timed_scope()
+    {
+        ZINC_SCOPE_TIMER("test.timer.single");
+    }
+
+    [[nodiscard]] std::string dump()
+    {
+        auto stream = std::ostringstream();
+
+        zinc::dump_instrumentation(stream);
+
+        return std::move(stream).str();
+    }
+} // namespace
+
+TEST_CASE("scope timers aggregate calls into the registry", "[util][instrument]")
+{
+    for (auto i = 0; i < 64; ++i)
+    {
+        timed_scope();
+    }
+
+    const auto output = dump();
+
+    REQUIRE(output.find("timer test.timer.single: 64 calls, ") != std::string::npos);
+}
+
+TEST_CASE("counters sum their per-thread cells", "[util][instrument]")
+{
+    auto threads = std::vector<std::thread>();
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([] {
+            for (auto j = 0; j < 100; ++j)
+            {
+                ZINC_COUNTER_ADD("test.counter.threaded", 3);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto output = dump();
+
+    REQUIRE(output.find("counter test.counter.threaded: 1200") != std::string::npos);
+}
+
+TEST_CASE("one timer site merges samples from every thread", "[util][instrument]")
+{
+    auto threads = std::vector<std::thread>();
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([] {
+            for (auto j = 0; j < 25; ++j)
+            {
+                ZINC_SCOPE_TIMER("test.timer.threaded");
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto output = dump();
+
+    REQUIRE(output.find("timer test.timer.threaded: 100 calls, ") != std::string::npos);
+}
+
+TEST_CASE("counters accept a computed amount", "[util][instrument]")
+{
+    for (auto i = 1; i <= 10; ++i)
+    {
+        ZINC_COUNTER_ADD("test.counter.computed", i * 2);
+    }
+
+    const auto output = dump();
+
+    REQUIRE(output.find("counter test.counter.computed: 110") != std::string::npos);
+}
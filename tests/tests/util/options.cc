@@ -0,0 +1,122 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/util/options.h"
+#include "catch2/catch.hpp"
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // the whole point: the table is compile-time data shared by every parse
+    constexpr auto parser = zinc::OptParser()
+                                .add_arg(zinc::Arg<bool>("verbose").short_name('v').description("Print more"))
+                                .add_arg(zinc::Arg<int>("jobs").short_name('j').flag(false).value_name("N"))
+                                .add_arg(zinc::Arg<std::string>("out").short_name('o').flag(false).value_name("FILE"))
+                                .add_arg(zinc::Arg<double>("scale").flag(false));
+
+    constexpr auto verbose = std::size_t{0};
+    constexpr auto jobs = std::size_t{1};
+    constexpr auto out = std::size_t{2};
+    constexpr auto scale = std::size_t{3};
+} // namespace
+
+TEST_CASE("long and short options parse into their slots", "[util][options]")
+{
+    constexpr std::array argv = {"tool", "--verbose", "-j", "8", "--out=build/a.o", "--scale", "2.5"};
+
+    const auto results = parser.parse(static_cast<int>(argv.size()), argv.data());
+
+    REQUIRE(results.ok());
+    REQUIRE(results.get<verbose>() == true);
+    REQUIRE(results.get<jobs>() == 8);
+    REQUIRE(results.get<out>() == "build/a.o");
+    REQUIRE(results.get<scale>() == 2.5);
+}
+
+TEST_CASE("options that never appear stay empty", "[util][options]")
+{
+    constexpr std::array argv = {"tool", "-v"};
+
+    const auto results = parser.parse(static_cast<int>(argv.size()), argv.data());
+
+    REQUIRE(results.ok());
+    REQUIRE(results.get<verbose>().has_value());
+    REQUIRE(!results.get<jobs>().has_value());
+    REQUIRE(!results.get<out>().has_value());
+}
+
+TEST_CASE("string values are views into argv, not copies", "[util][options]")
+{
+    constexpr std::array argv = {"tool", "-o", "some/long/path/that/would/heap/allocate/as/a/string.txt"};
+
+    const auto results = parser.parse(static_cast<int>(argv.size()), argv.data());
+
+    REQUIRE(results.ok());
+    REQUIRE(results.get<out>()->data() == argv[2]);
+}
+
+TEST_CASE("each kind of bad command line reports its own error", "[util][options]")
+{
+    const auto kind_of = [](std::initializer_list<const char*> tokens) {
+        auto argv = std::array<const char*, 4>{"tool"};
+        auto argc = 1;
+
+        for (const auto* token : tokens)
+        {
+            argv[static_cast<std::size_t>(argc++)] = token;
+        }
+
+        const auto results = parser.parse(argc, argv.data());
+
+        REQUIRE(!results.ok());
+
+        return results.error()->kind;
+    };
+
+    REQUIRE(kind_of({"--frobnicate"}) == zinc::OptParseErrorKind::unknown_option);
+    REQUIRE(kind_of({"-x"}) == zinc::OptParseErrorKind::unknown_option);
+    REQUIRE(kind_of({"--jobs"}) == zinc::OptParseErrorKind::missing_value);
+    REQUIRE(kind_of({"--jobs", "lots"}) == zinc::OptParseErrorKind::malformed_value);
+    REQUIRE(kind_of({"--scale", "2.5.0"}) == zinc::OptParseErrorKind::malformed_value);
+    REQUIRE(kind_of({"stray"}) == zinc::OptParseErrorKind::unexpected_positional);
+}
+
+TEST_CASE("boolean flags accept explicit =values too", "[util][options]")
+{
+    constexpr std::array argv = {"tool", "--verbose=false"};
+
+    const auto results = parser.parse(static_cast<int>(argv.size()), argv.data());
+
+    REQUIRE(results.ok());
+    REQUIRE(results.get<verbose>() == false);
+}
+
+TEST_CASE("help lists every argument in table order", "[util][options]")
+{
+    const auto help = parser.help();
+
+    REQUIRE(help.find("-v, --verbose") != std::string::npos);
+    REQUIRE(help.find("Print more") != std::string::npos);
+    REQUIRE(help.find("-j, --jobs <N>") != std::string::npos);
+    REQUIRE(help.find("-o, --out <FILE>") != std::string::npos);
+    REQUIRE(help.find("--scale") != std::string::npos);
+    REQUIRE(help.find("--verbose") < help.find("--jobs"));
+    REQUIRE(help.find("--jobs") < help.find("--out"));
+}
@@ -0,0 +1,162 @@
+//======---------------------------------------------------------------======//
+//                                                                           //
+// Copyright 2021 Evan Cox                                                   //
+//                                                                           //
+// Licensed under the Apache License, Version 2.0 (the "License");           //
+// you may not use this file except in compliance with the License.          //
+// You may obtain a copy of the License at                                   //
+//                                                                           //
+//    http://www.apache.org/licenses/LICENSE-2.0                             //
+//                                                                           //
+// Unless required by applicable law or agreed to in writing, software       //
+// distributed under the License is distributed on an "AS IS" BASIS,         //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  //
+// See the License for the specific language governing permissions and       //
+// limitations under the License.                                            //
+//                                                                           //
+//======---------------------------------------------------------------======//
+
+#include "zinc/util/uninitialized.h"
+#include "catch2/catch.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace
+{
+    struct Counted
+    {
+        explicit Counted(int initial) noexcept
+            : value(initial)
+        {}
+
+        Counted(Counted&& other) noexcept
+            : value(other.value)
+        {
+            ++moves;
+        }
+
+        ~Counted() { ++destroys; }
+
+        inline static int moves = 0;
+        inline static int destroys = 0;
+
+        int value;
+    };
+
+    // same shape as Counted, but promises its moves don't care where it lives
+    struct OptedIn
+    {
+        explicit OptedIn(int initial) noexcept
+            : value(initial)
+        {}
+
+        OptedIn(OptedIn&& other) noexcept
+            : value(other.value)
+        {
+            ++moves;
+        }
+
+        ~OptedIn() { ++destroys; }
+
+        inline static int moves = 0;
+        inline static int destroys = 0;
+
+        int value;
+    };
+} // namespace
+
+namespace zinc
+{
+    template <> struct TriviallyRelocatable<OptedIn>
+    {
+        constexpr static bool value = true;
+    };
+} // namespace zinc
+
+TEST_CASE("trivially copyable types relocate without any constructor traffic", "[util][uninitialized]")
+{
+    STATIC_REQUIRE(zinc::is_trivially_relocatable<int>);
+
+    auto alloc = std::allocator<int>();
+    int source[4] = {1, 2, 3, 4};
+    alignas(int) std::byte raw[sizeof(int) * 4];
+    auto* dest = reinterpret_cast<int*>(raw);
+
+    REQUIRE(zinc::uninitialized_relocate_n(alloc, source, 4, dest) == dest + 4);
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        REQUIRE(dest[i] == i + 1);
+    }
+}
+
+TEST_CASE("non-trivial types are moved over and destroyed behind", "[util][uninitialized]")
+{
+    STATIC_REQUIRE(!zinc::is_trivially_relocatable<Counted>);
+
+    auto alloc = std::allocator<Counted>();
+    alignas(Counted) std::byte source_raw[sizeof(Counted) * 3];
+    alignas(Counted) std::byte dest_raw[sizeof(Counted) * 3];
+    auto* source = reinterpret_cast<Counted*>(source_raw);
+    auto* dest = reinterpret_cast<Counted*>(dest_raw);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        std::construct_at(source + i, i);
+    }
+
+    Counted::moves = 0;
+    Counted::destroys = 0;
+
+    REQUIRE(zinc::uninitialized_relocate(alloc, source, source + 3, dest) == dest + 3);
+    REQUIRE(Counted::moves == 3);
+    REQUIRE(Counted::destroys == 3); // the sources, not the relocated elements
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        REQUIRE(dest[i].value == i);
+
+        std::destroy_at(dest + i);
+    }
+}
+
+TEST_CASE("opting into TriviallyRelocatable takes the memcpy path", "[util][uninitialized]")
+{
+    STATIC_REQUIRE(zinc::is_trivially_relocatable<OptedIn>);
+
+    auto alloc = std::allocator<OptedIn>();
+    alignas(OptedIn) std::byte source_raw[sizeof(OptedIn) * 3];
+    alignas(OptedIn) std::byte dest_raw[sizeof(OptedIn) * 3];
+    auto* source = reinterpret_cast<OptedIn*>(source_raw);
+    auto* dest = reinterpret_cast<OptedIn*>(dest_raw);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        std::construct_at(source + i, i * 10);
+    }
+
+    OptedIn::moves = 0;
+    OptedIn::destroys = 0;
+
+    REQUIRE(zinc::uninitialized_relocate_n(alloc, source, 3, dest) == dest + 3);
+
+    // the whole point of opting in: bytes moved, no special members ran
+    REQUIRE(OptedIn::moves == 0);
+    REQUIRE(OptedIn::destroys == 0);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        REQUIRE(dest[i].value == i * 10);
+
+        std::destroy_at(dest + i);
+    }
+}
+
+TEST_CASE("relocating zero elements touches nothing", "[util][uninitialized]")
+{
+    auto alloc = std::allocator<std::string>();
+    std::string* none = nullptr;
+
+    REQUIRE(zinc::uninitialized_relocate_n(alloc, none, 0, none) == nullptr);
+}